@@ -0,0 +1,156 @@
+/*
+    ai.c
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "ai.h"
+#include "fixed.h"
+#include "geometry.h"
+#include "tuning.h"
+
+#define player_velocity PADDLE_VELOCITY     // Field units per second, the same as for the human players.
+
+/* Prediction variables, one set for each of the players 1 and 2 that the computer can control. */
+typedef struct {
+    int seen_ball;                  // The ball that the current target was predicted from, -1 if none of them was on its way to the player.
+    fixed seen_dx;                  // Its velocity at the time.
+    fixed seen_dy;
+    int seen_size;                  // The ball size that the current target was predicted with, since it changes where the ball bounces.
+    int reacting;                   // 1 while the computer hasn't yet reacted to the latest change of the ball.
+    int reaction;                   // Physics steps left until it does.
+    fixed target;                   // Where the computer moves the center of the paddle to.
+} ai_state;
+
+static ai_state states[2] = {
+    { -1, 0, 0, 0, 0, 0, int_to_fixed(FIELD_HEIGHT/2) },
+    { -1, 0, 0, 0, 0, 0, int_to_fixed(FIELD_HEIGHT/2) },
+};
+static unsigned int random_state = 2463534242u;
+
+/**
+ * Returns a pseudo-random number, from a xorshift generator. The sequence is the same every run, so replays stay identical.
+ */
+static unsigned int next_random() {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/**
+ * Returns the ball that is closest to the paddle of the player of the ones moving towards it, or -1 if no ball is.
+ */
+static int closest_ball(int player) {
+    int side = paddles[player].side;
+    int closest = -1;
+    for (int ball = 0; ball < ball_slots; ball++) {
+        if (ball_alive[ball] && ball_dx[ball] * side > 0 && (closest < 0 || ball_fx[ball] * side > ball_fx[closest] * side)) closest = ball;
+    }
+    return closest;
+}
+
+/**
+ * Returns the height at which the center of the ball will reach the face of the paddle of the player, assuming that it keeps its velocity.
+ * The ball is followed in a straight line as if there were no walls, and the bounces are then folded back in between the walls.
+ * This takes the same time no matter how far away the ball is or how many times it will bounce.
+ * Parameter: the ball must be moving towards the player, who must be player 1 or 2.
+ */
+static fixed predict_arrival(int ball, int player) {
+    const paddle *p = &paddles[player];
+    fixed fx = ball_fx[ball] * p->side;         // Mirrored for player 1, so that the ball always moves towards larger x.
+    fixed fy = ball_fy[ball];
+    fixed dx = ball_dx[ball] * p->side;
+    fixed dy = ball_dy[ball];
+    fixed half_ball = int_to_fixed(ball_size/2);
+    fixed top = half_ball;
+    fixed bottom = int_to_fixed(FIELD_HEIGHT) - half_ball;
+    fixed face = p->side < 0 ? -(int_to_fixed(p->line + PLAYER_WIDTH) + half_ball) : int_to_fixed(p->line) - half_ball;
+    fixed distance = face - fx;
+
+    if (distance <= 0) return fy;
+
+    /* Time to arrival in physics steps, split into whole steps and a fraction of a step so that no 64-bit division is needed. */
+    int steps = distance / dx;
+    fixed fraction = fixed_fraction(distance - steps * dx, dx);
+    fixed travel = steps * dy + fixed_mul(dy, fraction);   // How far the ball moves vertically, without the walls.
+
+    fixed height = bottom - top;
+    if (height <= 0) return fy;
+
+    fixed position = (fy - top + travel) % (2 * height);      // A bounce mirrors the position, so the path repeats every two heights.
+    if (position < 0) position += 2 * height;
+    if (position > height) position = 2 * height - position;
+    return top + position;
+}
+
+/**
+ * Sets the velocity of the paddle of the player so that it moves towards where the closest ball on its way to the player will arrive.
+ * The arrival is only predicted again when another ball becomes the closest one or the ball changes velocity or size, and not until the reaction time has passed since then.
+ * Each prediction is off by a random number of pixels, up to AI_ERROR.
+ * Parameter: player is the player number minus one, 0 or 1.
+ */
+void ai_update_player(int player) {
+    ai_state *state = &states[player];
+    int ball = closest_ball(player);
+    fixed dx = ball >= 0 ? ball_dx[ball] : 0;
+    fixed dy = ball >= 0 ? ball_dy[ball] : 0;
+
+    if (ball != state->seen_ball || dx != state->seen_dx || dy != state->seen_dy || ball_size != state->seen_size) {
+        state->seen_ball = ball;
+        state->seen_dx = dx;
+        state->seen_dy = dy;
+        state->seen_size = ball_size;
+        state->reaction = AI_REACTION_STEPS;
+        state->reacting = 1;
+    }
+
+    if (state->reacting && state->reaction > 0) {
+        state->reaction--;
+    } else if (state->reacting) {
+        state->reacting = 0;
+        if (ball >= 0) {
+            int error = (int)(next_random() % (2 * AI_ERROR + 1)) - AI_ERROR;
+            state->target = predict_arrival(ball, player) + int_to_fixed(error);
+        } else {
+            state->target = int_to_fixed(FIELD_HEIGHT/2);           // Wait in the middle while the ball is on its way to the other player.
+        }
+    }
+
+    fixed speed = per_step(player_velocity);
+    paddle *p = &paddles[player];
+    fixed difference = state->target - p->position;
+    if (difference > speed) {
+        p->velocity = speed;
+    } else if (difference < -speed) {
+        p->velocity = -speed;
+    } else {
+        p->velocity = 0;
+    }
+
+    if (p->reversed) p->velocity = -p->velocity;                    // The computer isn't fooled by REVERSE-PADDLES.
+}
+
+/**
+ * Lets the computer move player 2.
+ */
+void ai_update() {
+    ai_update_player(1);
+}
+
+/**
+ * Restarts the computer players with the given seed for their random errors, and forgets what they have seen.
+ */
+void ai_reset(unsigned int seed) {
+    for (int player = 0; player < 2; player++) {
+        states[player].seen_ball = -1;
+        states[player].seen_dx = 0;
+        states[player].seen_dy = 0;
+        states[player].seen_size = 0;
+        states[player].reacting = 0;
+        states[player].reaction = 0;
+        states[player].target = int_to_fixed(FIELD_HEIGHT/2);
+    }
+    random_state = seed ? seed : 2463534242u;                       // xorshift never leaves zero.
+}
@@ -0,0 +1,27 @@
+/*
+    ai.h
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef AI_H
+#define AI_H
+
+#include "pong.h"
+
+/* How long it takes the computer to react to a new direction of the ball, in physics steps. Can be set when building. */
+#ifndef AI_REACTION_STEPS
+#define AI_REACTION_STEPS (PHYSICS_HZ / 5)
+#endif
+
+/* The largest number of pixels that the computer misjudges where the ball will arrive by. Can be set when building. */
+#ifndef AI_ERROR
+#define AI_ERROR 12
+#endif
+
+void ai_update();
+void ai_update_player(int player);
+void ai_reset(unsigned int seed);
+
+#endif
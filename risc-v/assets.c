@@ -0,0 +1,640 @@
+/*
+    assets.c
+    Generated by host/rle-encode from the images in assets/. Do not edit.
+*/
+
+#include <stdint.h>
+#include "assets.h"
+
+static const uint32_t game_over_runs[] = {
+    0x000a0831, 0x000130ff, 0x00001031, 0x000130ff, 0x00001031, 0x000130ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x00000cff, 0x00000c31, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00000431, 0x000010ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x00000cff, 0x00000c31, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00000431, 0x000010ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x00000cff, 0x00000c31, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00000431, 0x000010ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x00000cff, 0x00000c31, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff,
+    0x00000831, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00000431, 0x000010ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000008ff, 0x00000431, 0x000008ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000008ff, 0x00000431, 0x000008ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000008ff, 0x00000431, 0x000008ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000008ff, 0x00000431, 0x000008ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00001431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00001431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00001431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00001431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000431, 0x00000cff,
+    0x00000431, 0x000014ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000010ff, 0x00002031, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000010ff, 0x00000831, 0x000010ff, 0x00002f31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000431, 0x00000cff, 0x00000431, 0x000014ff,
+    0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000010ff,
+    0x00002031, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000010ff, 0x00000831, 0x000010ff, 0x00002f31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00002b31, 0x000004ff, 0x00000431, 0x00000cff, 0x00000431, 0x000014ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000431, 0x000004ff, 0x00000431, 0x000010ff, 0x00002031, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000010ff,
+    0x00000831, 0x000010ff, 0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff,
+    0x00000431, 0x00000cff, 0x00000431, 0x000014ff, 0x00000431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000431, 0x000010ff, 0x00002031, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000010ff, 0x00000831, 0x000010ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00003331, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00003331, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00003331, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00001431, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00003331, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000831, 0x000004ff, 0x00001431, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000831, 0x000004ff, 0x00001431, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000831, 0x000004ff, 0x00001431, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002b31, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00002c31, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000831, 0x000004ff, 0x00001431, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00002f31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x000010ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff,
+    0x00002031, 0x00000cff, 0x00001031, 0x000004ff, 0x00000c31, 0x000014ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00002f31, 0x000010ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000014ff, 0x00002031, 0x00000cff, 0x00001031, 0x000004ff, 0x00000c31, 0x000014ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00002b31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00002f31, 0x000010ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000004ff,
+    0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff, 0x00001031, 0x000004ff,
+    0x00000c31, 0x000014ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00002b31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00002f31, 0x000010ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00000431, 0x000004ff, 0x00000c31, 0x000004ff, 0x00000431, 0x000014ff, 0x00002031, 0x00000cff,
+    0x00001031, 0x000004ff, 0x00000c31, 0x000014ff, 0x00000431, 0x000004ff, 0x00000c31, 0x000004ff,
+    0x00002b31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00001d31, 0x0000f0ff, 0x00001d31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00001d31, 0x0000f0ff, 0x00001d31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00003b31, 0x000004ff, 0x00000231, 0x000004ff, 0x00000231, 0x000005ff, 0x00000231, 0x000004ff,
+    0x00000231, 0x000004ff, 0x00000731, 0x000005ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000005ff, 0x00000731, 0x000004ff, 0x00000231, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000005ff, 0x00000131, 0x000005ff, 0x00000231, 0x000003ff, 0x00000231, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000731, 0x000005ff, 0x00000231, 0x000003ff, 0x00000831, 0x000004ff,
+    0x00000231, 0x000001ff, 0x00000631, 0x000003ff, 0x00000231, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000831, 0x000003ff, 0x00000331, 0x000003ff, 0x00000331, 0x000003ff, 0x00000331, 0x000003ff,
+    0x00000231, 0x000001ff, 0x00000331, 0x000001ff, 0x00003c31, 0x000003ff, 0x00001031, 0x000003ff,
+    0x00003b31, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000531, 0x000001ff, 0x00000531, 0x000001ff, 0x00000d31, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000b31, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000731, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000731, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00003c31, 0x000003ff, 0x00001031, 0x000003ff, 0x00003b31, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000d31, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000b31, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000531, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000002ff, 0x00000231, 0x000001ff, 0x00000931, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000731, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000531, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000731, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000002ff,
+    0x00000231, 0x000001ff, 0x00003c31, 0x000003ff, 0x00001031, 0x000003ff, 0x00003b31, 0x000004ff,
+    0x00000231, 0x000004ff, 0x00000231, 0x000004ff, 0x00000331, 0x000003ff, 0x00000331, 0x000003ff,
+    0x00000a31, 0x000001ff, 0x00000331, 0x000005ff, 0x00000131, 0x000004ff, 0x00000831, 0x000004ff,
+    0x00000231, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000731, 0x000004ff, 0x00000231, 0x000001ff, 0x00000531, 0x000005ff, 0x00000231, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000831, 0x000005ff, 0x00000131, 0x000001ff, 0x00000131, 0x000003ff,
+    0x00000131, 0x000005ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00003c31, 0x000003ff, 0x00001031, 0x000003ff, 0x00003b31, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000931, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000b31, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000531, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000231, 0x000002ff, 0x00000931, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000731, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000531, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000931, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000231, 0x000002ff,
+    0x00003c31, 0x000003ff, 0x00001031, 0x000003ff, 0x00003b31, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000231, 0x000001ff, 0x00000231, 0x000001ff, 0x00000931, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000931, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff,
+    0x00000b31, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000531, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000731, 0x000001ff, 0x00000531, 0x000001ff, 0x00000531, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00003c31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00003b31, 0x000001ff, 0x00000531, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000131, 0x000005ff, 0x00000131, 0x000004ff, 0x00000231, 0x000004ff, 0x00000a31, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000331, 0x000001ff, 0x00000131, 0x000005ff, 0x00000731, 0x000004ff,
+    0x00000331, 0x000003ff, 0x00000431, 0x000001ff, 0x00000531, 0x000001ff, 0x00000431, 0x000003ff,
+    0x00000231, 0x000001ff, 0x00000331, 0x000001ff, 0x00000931, 0x000001ff, 0x00000431, 0x000003ff,
+    0x00000831, 0x000001ff, 0x00000531, 0x000005ff, 0x00000131, 0x000001ff, 0x00000331, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00000931, 0x000001ff, 0x00000331, 0x000001ff, 0x00000231, 0x000004ff,
+    0x00000131, 0x000001ff, 0x00000331, 0x000001ff, 0x00000231, 0x000003ff, 0x00000231, 0x000001ff,
+    0x00000331, 0x000001ff, 0x00003c31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000003ff, 0x00012a31, 0x000003ff,
+    0x00001031, 0x000003ff, 0x00012a31, 0x000003ff, 0x00001031, 0x000130ff, 0x00001031, 0x000130ff,
+    0x00001031, 0x000130ff, 0x000a0831,
+};
+
+const image game_over_image = { 320, 240, 2107, game_over_runs };
+
+static const uint32_t pause_runs[] = {
+    0x000142ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00,
+    0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00,
+    0x000004ff, 0x00001900, 0x00000cff, 0x00000900, 0x000009ff, 0x00000600, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x00000cff, 0x00000300, 0x00000fff, 0x00000300, 0x000009ff, 0x00002000,
+    0x000004ff, 0x00001900, 0x00000cff, 0x00000900, 0x000009ff, 0x00000600, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x00000cff, 0x00000300, 0x00000fff, 0x00000300, 0x000009ff, 0x00002000,
+    0x000004ff, 0x00001900, 0x00000cff, 0x00000900, 0x000009ff, 0x00000600, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x00000cff, 0x00000300, 0x00000fff, 0x00000300, 0x000009ff, 0x00002000,
+    0x000004ff, 0x00001900, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000600, 0x000003ff, 0x00001d00, 0x000004ff, 0x00001900,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000f00,
+    0x000003ff, 0x00000600, 0x000003ff, 0x00001d00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000600,
+    0x000003ff, 0x00001d00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00,
+    0x000004ff, 0x00001900, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00, 0x000004ff, 0x00001900,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000f00,
+    0x000003ff, 0x00000900, 0x000003ff, 0x00001a00, 0x000004ff, 0x00001900, 0x00000cff, 0x00000600,
+    0x00000fff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000600, 0x000009ff, 0x00000600,
+    0x00000cff, 0x00000600, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00, 0x000004ff, 0x00001900,
+    0x00000cff, 0x00000600, 0x00000fff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000600,
+    0x000009ff, 0x00000600, 0x00000cff, 0x00000600, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00,
+    0x000004ff, 0x00001900, 0x00000cff, 0x00000600, 0x00000fff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x000009ff, 0x00000600, 0x00000cff, 0x00000600, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00001a00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00, 0x000004ff, 0x00001900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00001a00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00001a00, 0x000004ff, 0x00001900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000600,
+    0x000003ff, 0x00001d00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000300, 0x000003ff, 0x00000900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000300,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000600, 0x000003ff, 0x00001d00, 0x000004ff, 0x00001900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000900, 0x000003ff, 0x00000300, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000f00, 0x000003ff, 0x00000300, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000600,
+    0x000003ff, 0x00001d00, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x000009ff, 0x00000600, 0x00000cff, 0x00000600, 0x00000fff, 0x00000300,
+    0x000009ff, 0x00002000, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x000009ff, 0x00000600, 0x00000cff, 0x00000600, 0x00000fff, 0x00000300,
+    0x000009ff, 0x00002000, 0x000004ff, 0x00001900, 0x000003ff, 0x00000f00, 0x000003ff, 0x00000900,
+    0x000003ff, 0x00000600, 0x000009ff, 0x00000600, 0x00000cff, 0x00000600, 0x00000fff, 0x00000300,
+    0x000009ff, 0x00002000, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00,
+    0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00001b00, 0x00000592, 0x00000100,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000492, 0x00000200, 0x00000192, 0x00000300,
+    0x00000192, 0x00000800, 0x00000392, 0x00000200, 0x00000592, 0x00000100, 0x00000592, 0x00000800,
+    0x00000392, 0x00000900, 0x00000492, 0x00000100, 0x00000192, 0x00000300, 0x00000192, 0x00000200,
+    0x00000392, 0x00000200, 0x00000592, 0x00000200, 0x00000392, 0x00000200, 0x00000192, 0x00000300,
+    0x00000192, 0x00001c00, 0x000004ff, 0x00001d00, 0x00000192, 0x00000300, 0x00000192, 0x00000300,
+    0x00000192, 0x00000100, 0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000300,
+    0x00000192, 0x00000700, 0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000500,
+    0x00000192, 0x00000b00, 0x00000192, 0x00000300, 0x00000192, 0x00000700, 0x00000192, 0x00000500,
+    0x00000192, 0x00000300, 0x00000192, 0x00000300, 0x00000192, 0x00000500, 0x00000192, 0x00000300,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000300, 0x00000192, 0x00001c00,
+    0x000004ff, 0x00001d00, 0x00000192, 0x00000300, 0x00000192, 0x00000300, 0x00000192, 0x00000100,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000292, 0x00000200, 0x00000192, 0x00000700,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000500, 0x00000192, 0x00000b00,
+    0x00000192, 0x00000300, 0x00000192, 0x00000700, 0x00000192, 0x00000500, 0x00000192, 0x00000300,
+    0x00000192, 0x00000300, 0x00000192, 0x00000500, 0x00000192, 0x00000300, 0x00000192, 0x00000500,
+    0x00000192, 0x00000300, 0x00000192, 0x00001c00, 0x000004ff, 0x00001d00, 0x00000192, 0x00000300,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000492, 0x00000200, 0x00000192, 0x00000100,
+    0x00000192, 0x00000100, 0x00000192, 0x00000700, 0x00000192, 0x00000300, 0x00000192, 0x00000100,
+    0x00000492, 0x00000200, 0x00000492, 0x00000800, 0x00000592, 0x00000800, 0x00000392, 0x00000200,
+    0x00000192, 0x00000100, 0x00000192, 0x00000100, 0x00000192, 0x00000300, 0x00000192, 0x00000500,
+    0x00000192, 0x00000300, 0x00000192, 0x00000500, 0x00000592, 0x00001c00, 0x000004ff, 0x00001d00,
+    0x00000192, 0x00000300, 0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000100,
+    0x00000192, 0x00000300, 0x00000192, 0x00000200, 0x00000292, 0x00000700, 0x00000192, 0x00000300,
+    0x00000192, 0x00000100, 0x00000192, 0x00000500, 0x00000192, 0x00000b00, 0x00000192, 0x00000300,
+    0x00000192, 0x00000b00, 0x00000192, 0x00000100, 0x00000192, 0x00000100, 0x00000192, 0x00000100,
+    0x00000192, 0x00000300, 0x00000192, 0x00000500, 0x00000192, 0x00000300, 0x00000192, 0x00000500,
+    0x00000192, 0x00000300, 0x00000192, 0x00001c00, 0x000004ff, 0x00001d00, 0x00000192, 0x00000300,
+    0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000200, 0x00000192, 0x00000200,
+    0x00000192, 0x00000300, 0x00000192, 0x00000700, 0x00000192, 0x00000300, 0x00000192, 0x00000100,
+    0x00000192, 0x00000500, 0x00000192, 0x00000b00, 0x00000192, 0x00000300, 0x00000192, 0x00000b00,
+    0x00000192, 0x00000100, 0x00000192, 0x00000100, 0x00000192, 0x00000100, 0x00000192, 0x00000300,
+    0x00000192, 0x00000500, 0x00000192, 0x00000300, 0x00000192, 0x00000300, 0x00000192, 0x00000100,
+    0x00000192, 0x00000300, 0x00000192, 0x00001c00, 0x000004ff, 0x00001d00, 0x00000192, 0x00000400,
+    0x00000392, 0x00000200, 0x00000192, 0x00000300, 0x00000192, 0x00000100, 0x00000192, 0x00000300,
+    0x00000192, 0x00000800, 0x00000392, 0x00000200, 0x00000192, 0x00000500, 0x00000192, 0x00000b00,
+    0x00000192, 0x00000300, 0x00000192, 0x00000700, 0x00000492, 0x00000300, 0x00000192, 0x00000100,
+    0x00000192, 0x00000300, 0x00000392, 0x00000400, 0x00000192, 0x00000400, 0x00000392, 0x00000200,
+    0x00000192, 0x00000300, 0x00000192, 0x00001c00, 0x000004ff, 0x00009c00, 0x000004ff, 0x00009c00,
+    0x000004ff, 0x00009c00, 0x000142ff,
+};
+
+const image pause_image = { 160, 48, 739, pause_runs };
+
+static const uint32_t title_runs[] = {
+    0x000500ff, 0x00009f00, 0x00000392, 0x00013d00, 0x00000392, 0x0008bd00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x0008bd00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00083400, 0x000030ff, 0x00002400,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800,
+    0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800,
+    0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x000030ff, 0x00002400,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800,
+    0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800,
+    0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x000030ff, 0x00002400,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800,
+    0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800,
+    0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x000030ff, 0x00002400, 0x000024ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000024ff, 0x00003800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00005c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x000018ff, 0x00001800, 0x00000cff, 0x00000c00, 0x00000cff, 0x00005c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x000030ff, 0x00001800,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00000c00, 0x000024ff, 0x00002c00, 0x00000cff, 0x00003c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00001800, 0x000018ff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00002c00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00,
+    0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00001800,
+    0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00003c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00001800, 0x000018ff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00002c00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00000c00, 0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00002c00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00001800, 0x000018ff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00003c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000c00,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00000c00, 0x00000cff, 0x00002400, 0x00000cff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001100, 0x00000392, 0x00000400,
+    0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00,
+    0x00000cff, 0x00004800, 0x000024ff, 0x00001100, 0x00000392, 0x00000400, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800,
+    0x000024ff, 0x00001100, 0x00000392, 0x00000400, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800,
+    0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001100,
+    0x00000392, 0x00000400, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00,
+    0x000005ff, 0x00001a00, 0x00000cff, 0x00004800, 0x000024ff, 0x00001800, 0x00000cff, 0x00002400,
+    0x00000cff, 0x00001800, 0x000030ff, 0x00000d00, 0x000005ff, 0x00001a00, 0x00000cff, 0x00004800,
+    0x000024ff, 0x00001800, 0x00000cff, 0x00002400, 0x00000cff, 0x00001800, 0x000030ff, 0x00000d00,
+    0x000005ff, 0x0000a300, 0x00000392, 0x00013d00, 0x00000392, 0x00038b00, 0x000006fc, 0x00000400,
+    0x000002fc, 0x00000600, 0x000002fc, 0x00000e00, 0x000008fc, 0x00000600, 0x000006fc, 0x00000600,
+    0x000008fc, 0x00000400, 0x000006fc, 0x00001000, 0x000002fc, 0x00000600, 0x000002fc, 0x0000d800,
+    0x000006fc, 0x00000400, 0x000002fc, 0x00000600, 0x000002fc, 0x00000e00, 0x000008fc, 0x00000600,
+    0x000006fc, 0x00000600, 0x000008fc, 0x00000400, 0x000006fc, 0x00001000, 0x000002fc, 0x00000600,
+    0x000002fc, 0x0000d600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000a00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000e00, 0x000002fc, 0x00000600,
+    0x000002fc, 0x0000d600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000a00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000e00, 0x000002fc, 0x00000600,
+    0x000002fc, 0x0000d600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000004fc, 0x00000400,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000a00, 0x000002fc, 0x00001600, 0x000002fc, 0x00000600, 0x000002fc, 0x0000d600,
+    0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000004fc, 0x00000400, 0x000002fc, 0x00000e00,
+    0x000002fc, 0x00000600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000a00,
+    0x000002fc, 0x00001600, 0x000002fc, 0x00000600, 0x000002fc, 0x0000d600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000200, 0x000002fc, 0x00000200, 0x000002fc, 0x00000200, 0x000002fc, 0x00000e00,
+    0x000008fc, 0x00000800, 0x000002fc, 0x00000800, 0x000006fc, 0x00000400, 0x000002fc, 0x00000a00,
+    0x00000afc, 0x00000200, 0x000002fc, 0x00000600, 0x000002fc, 0x0000d600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000200, 0x000002fc, 0x00000200, 0x000002fc, 0x00000200, 0x000002fc, 0x00000e00,
+    0x000008fc, 0x00000800, 0x000002fc, 0x00000800, 0x000006fc, 0x00000400, 0x000002fc, 0x00000a00,
+    0x00000afc, 0x00000200, 0x000002fc, 0x00000600, 0x000002fc, 0x0000d600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000200, 0x000002fc, 0x00000400, 0x000004fc, 0x00000e00, 0x000002fc, 0x00000200,
+    0x000002fc, 0x00000a00, 0x000002fc, 0x00000e00, 0x000002fc, 0x00000200, 0x000002fc, 0x00001600,
+    0x000002fc, 0x00000600, 0x000002fc, 0x0000d600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200,
+    0x000002fc, 0x00000400, 0x000004fc, 0x00000e00, 0x000002fc, 0x00000200, 0x000002fc, 0x00000a00,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000200, 0x000002fc, 0x00001600, 0x000002fc, 0x00000600,
+    0x000002fc, 0x0000d600, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000400, 0x000002fc, 0x00000800, 0x000002fc, 0x00000e00,
+    0x000002fc, 0x00000200, 0x000002fc, 0x00000600, 0x000002fc, 0x00001000, 0x000002fc, 0x00000200,
+    0x000002fc, 0x0000d800, 0x000002fc, 0x00000600, 0x000002fc, 0x00000200, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000400, 0x000002fc, 0x00000800, 0x000002fc, 0x00000e00,
+    0x000002fc, 0x00000200, 0x000002fc, 0x00000600, 0x000002fc, 0x00001000, 0x000002fc, 0x00000200,
+    0x000002fc, 0x0000da00, 0x000006fc, 0x00000400, 0x000002fc, 0x00000600, 0x000002fc, 0x00000e00,
+    0x000002fc, 0x00000600, 0x000002fc, 0x00000400, 0x000006fc, 0x00000400, 0x000008fc, 0x00000600,
+    0x000006fc, 0x00001400, 0x000002fc, 0x0000dc00, 0x000006fc, 0x00000400, 0x000002fc, 0x00000600,
+    0x000002fc, 0x00000e00, 0x000002fc, 0x00000600, 0x000002fc, 0x00000400, 0x000006fc, 0x00000400,
+    0x000008fc, 0x00000600, 0x000006fc, 0x00001400, 0x000002fc, 0x00088e00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x0000a600, 0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00,
+    0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x00009200,
+    0x00000392, 0x0000a600, 0x000005ff, 0x00009200, 0x00000392, 0x0000a600, 0x000005ff, 0x00009200,
+    0x00000392, 0x0000a600, 0x000005ff, 0x00009200, 0x00000392, 0x0000a600, 0x000005ff, 0x00009200,
+    0x00000392, 0x00002600, 0x000005ff, 0x00007b00, 0x000005ff, 0x00009200, 0x00000392, 0x00002600,
+    0x000005ff, 0x00007b00, 0x000005ff, 0x0000bb00, 0x000005ff, 0x00007b00, 0x000005ff, 0x0000bb00,
+    0x000005ff, 0x00007b00, 0x000005ff, 0x0000bb00, 0x000005ff, 0x00007b00, 0x000005ff, 0x00013b00,
+    0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x00009200, 0x00000392, 0x0000a600,
+    0x000005ff, 0x00009200, 0x00000392, 0x0000a600, 0x000005ff, 0x00009200, 0x00000392, 0x0000a600,
+    0x000005ff, 0x00009200, 0x00000392, 0x0000a600, 0x000005ff, 0x00009200, 0x00000392, 0x0000a600,
+    0x000005ff, 0x00009200, 0x00000392, 0x0000a600, 0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00,
+    0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x00013b00, 0x000005ff, 0x0001d200,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x0008bd00, 0x00000392, 0x00013d00, 0x00000392, 0x0004b300,
+    0x000004ff, 0x00000200, 0x000004ff, 0x00000200, 0x000005ff, 0x00000200, 0x000004ff, 0x00000200,
+    0x000004ff, 0x00000700, 0x000005ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000005ff, 0x00000700, 0x000004ff, 0x00000200, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000005ff, 0x00000100, 0x000005ff, 0x00000200, 0x000003ff, 0x00000200, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000700, 0x000005ff, 0x00000200, 0x000003ff, 0x00000900, 0x000004ff, 0x00000100,
+    0x000005ff, 0x00000200, 0x000003ff, 0x00000200, 0x000004ff, 0x00000200, 0x000005ff, 0x0000ab00,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000500, 0x000001ff, 0x00000d00, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000b00, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000500,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000900, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000700,
+    0x000001ff, 0x00000700, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x0000ad00, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000500,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000d00, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000b00, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000500, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000002ff, 0x00000200, 0x000001ff, 0x00000900,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000700, 0x000001ff, 0x00000700,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x0000ad00, 0x000004ff, 0x00000200, 0x000004ff, 0x00000200,
+    0x000004ff, 0x00000300, 0x000003ff, 0x00000300, 0x000003ff, 0x00000a00, 0x000001ff, 0x00000300,
+    0x000005ff, 0x00000100, 0x000004ff, 0x00000800, 0x000004ff, 0x00000200, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000500, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000100, 0x000001ff, 0x00000100, 0x000001ff, 0x00000900,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000800, 0x000003ff, 0x00000400,
+    0x000001ff, 0x00000300, 0x000005ff, 0x00000100, 0x000004ff, 0x00000400, 0x000001ff, 0x0000ad00,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000900,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000900, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000b00, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000500, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000200, 0x000002ff, 0x00000900,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000b00, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000500, 0x000001ff, 0x0000ad00, 0x000001ff, 0x00000500, 0x000001ff, 0x00000200,
+    0x000001ff, 0x00000200, 0x000001ff, 0x00000900, 0x000001ff, 0x00000500, 0x000001ff, 0x00000900,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000b00,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000900, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000b00, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000001ff, 0x00000200, 0x000001ff, 0x00000400, 0x000001ff, 0x0000ad00,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000005ff, 0x00000100,
+    0x000004ff, 0x00000200, 0x000004ff, 0x00000a00, 0x000001ff, 0x00000300, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000100, 0x000005ff, 0x00000700, 0x000004ff, 0x00000300, 0x000003ff, 0x00000400,
+    0x000001ff, 0x00000500, 0x000001ff, 0x00000400, 0x000003ff, 0x00000200, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000900, 0x000001ff, 0x00000400, 0x000003ff, 0x00000800, 0x000004ff, 0x00000400,
+    0x000001ff, 0x00000300, 0x000001ff, 0x00000300, 0x000001ff, 0x00000100, 0x000001ff, 0x00000300,
+    0x000001ff, 0x00000300, 0x000001ff, 0x0005f700, 0x00000392, 0x00013d00, 0x00000392, 0x0008bd00,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x0008bd00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00,
+    0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00013d00, 0x00000392, 0x00031e00,
+    0x000500ff,
+};
+
+const image title_image = { 320, 240, 2081, title_runs };
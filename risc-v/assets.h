@@ -0,0 +1,18 @@
+/*
+    assets.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include "image.h"
+
+/* The images in assets/, encoded into assets.c when building. */
+extern const image title_image;         // Shown at start-up until the push-button is pressed.
+extern const image game_over_image;     // Background of the game over screen, which the winner and the final score are drawn on.
+extern const image pause_image;         // Drawn in the middle of the screen while the game is paused.
+
+#endif
@@ -0,0 +1,178 @@
+/*
+    capture.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "capture.h"
+
+#ifdef CAPTURE
+
+#include <stdint.h>
+#include "geometry.h"
+#include "log.h"
+#include "render.h"
+
+/*
+The frames are sent as lines in the log, so they never get mixed up with the other messages:
+
+    cap <frame> <key> <width> <height>      Starts a frame. key is 1 if the frame is XORed with a black frame instead of the last one that was sent.
+    capd <runs>                             The next runs of the frame, in base64.
+    cape <frame> <checksum>                 Ends the frame.
+
+frame counts the presented frames since start-up, so the frames that were left out while the previous one was being sent show as gaps.
+The runs cover the XORed frame from the top left pixel, row by row. Each run is the number of unchanged pixels before it, the number of pixels in it,
+and the byte that all of them are XORed with. Both numbers are written 7 bits at a time from the lowest, with the top bit set on all bytes but the last.
+The pixels after the last run are unchanged. The checksum is of the whole frame: starting from 0, for each 32-bit little-endian word of pixels
+it is rotated left by one bit and XORed with the word.
+
+A frame is only taken when the previous one has been sent completely. It is XORed with the previous one into delta right away, since the framebuffer
+it was drawn in is drawn over two frames later, and then encoded a line at a time as there is room in the log. Half of the log is left for the other messages.
+*/
+
+#if LOG_BUFFER_SIZE < 256
+#error "CAPTURE needs a LOG_BUFFER_SIZE of at least 256"
+#endif
+
+#define data_bytes 48                           // Bytes of runs per capd line, which are 64 characters in base64.
+#define max_run_bytes 7                         // Two numbers below 2^21 and the XOR byte.
+#define line_room (5 + data_bytes / 3 * 4 + 1)  // The longest capd line.
+#define reserved_room (LOG_BUFFER_SIZE / 2)     // Room in the log that is left for the other messages.
+
+static uint32_t reference[SCREEN_PIXELS / 4];   // The last frame that was taken.
+static uint32_t delta[SCREEN_PIXELS / 4];       // The frame being sent, XORed with the one before it.
+
+/* The frame being sent */
+static int sending = 0;                         // 1 from when a frame is taken until its cape line has been logged.
+static int header_sent = 0;
+static int key = 0;
+static int position = 0;                        // The first pixel of delta that hasn't been encoded.
+static unsigned int number = 0;
+static unsigned int checksum = 0;
+static unsigned char pending[data_bytes + max_run_bytes];   // Encoded runs that haven't been logged.
+static int pending_count = 0;
+
+static unsigned int presented = 0;              // Frames presented since start-up.
+static unsigned int sent = 0;                   // Frames taken since start-up.
+
+/**
+ * Takes the frame that was just presented, unless the previous one is still being sent. Called after each present_frame().
+ * A frame that is the same as the last one taken isn't sent at all.
+ */
+void capture_frame() {
+    presented++;
+    if (sending) return;
+
+    const volatile uint32_t *frame = (const volatile uint32_t*) render_presented();
+    uint32_t changed = 0;
+    uint32_t sum = 0;
+    key = sent % CAPTURE_KEY_INTERVAL == 0;
+    for (int i = 0; i < SCREEN_PIXELS / 4; i++) {
+        uint32_t word = frame[i];
+        delta[i] = key ? word : word ^ reference[i];
+        reference[i] = word;
+        changed |= delta[i];
+        sum = ((sum << 1) | (sum >> 31)) ^ word;
+    }
+    if (!changed) return;
+
+    sending = 1;
+    header_sent = 0;
+    position = 0;
+    pending_count = 0;
+    number = presented;
+    checksum = sum;
+    sent++;
+}
+
+/**
+ * Adds a number to the encoded runs, 7 bits at a time from the lowest.
+ */
+static void put_number(unsigned int value) {
+    while (value >= 0x80) {
+        pending[pending_count++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    pending[pending_count++] = (unsigned char)value;
+}
+
+/**
+ * Encodes runs of delta until there is a line of them or the end of the frame has been reached.
+ * Unchanged pixels are skipped a word at a time where possible, since most of the frame is unchanged.
+ */
+static void encode_runs() {
+    const unsigned char *bytes = (const unsigned char*) delta;
+    while (pending_count < data_bytes && position < SCREEN_PIXELS) {
+        int start = position;
+        while (position < SCREEN_PIXELS && bytes[position] == 0) {
+            if (!(position & 3) && delta[position >> 2] == 0) position += 4;
+            else position++;
+        }
+        if (position == SCREEN_PIXELS) return;
+
+        unsigned char value = bytes[position];
+        int end = position + 1;
+        while (end < SCREEN_PIXELS && bytes[end] == value) end++;
+        put_number(position - start);
+        put_number(end - position);
+        pending[pending_count++] = value;
+        position = end;
+    }
+}
+
+/**
+ * Adds bytes to the message in base64.
+ */
+static void log_base64(const unsigned char *data, int count) {
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (int i = 0; i < count; i += 3) {
+        unsigned int group = data[i] << 16;
+        if (i + 1 < count) group |= data[i + 1] << 8;
+        if (i + 2 < count) group |= data[i + 2];
+        log_char(digits[group >> 18]);
+        log_char(digits[(group >> 12) & 63]);
+        log_char(i + 1 < count ? digits[(group >> 6) & 63] : '=');
+        log_char(i + 2 < count ? digits[group & 63] : '=');
+    }
+}
+
+/**
+ * Logs the next lines of the frame being sent, as long as that leaves half of the log for the other messages. Never waits.
+ * Called from the main loop before log_drain().
+ */
+void capture_drain() {
+    while (sending && log_room() >= reserved_room + line_room) {
+        log_begin();
+        if (!header_sent) {
+            log_text("cap ");
+            log_dec(number);
+            log_char(' ');
+            log_dec(key);
+            log_char(' ');
+            log_dec(SCREEN_WIDTH);
+            log_char(' ');
+            log_dec(SCREEN_HEIGHT);
+            header_sent = 1;
+        } else {
+            encode_runs();
+            if (pending_count > 0) {
+                int count = pending_count < data_bytes ? pending_count : data_bytes;
+                log_text("capd ");
+                log_base64(pending, count);
+                for (int i = count; i < pending_count; i++) pending[i - count] = pending[i];
+                pending_count -= count;
+            } else {
+                log_text("cape ");
+                log_dec(number);
+                log_char(' ');
+                log_hex(checksum);
+                sending = 0;
+            }
+        }
+        log_char('\n');
+        log_end();
+    }
+}
+
+#endif
@@ -0,0 +1,37 @@
+/*
+    capture.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+/*
+Frame capture over the JTAG UART, for watching the game on a board without a screen, see capture.c.
+Each presented frame is XORed with the last frame that was sent, and only the runs of changed pixels are sent, so the bandwidth follows the number of pixels that move.
+host/capture-decode rebuilds the frames from the output. Only compiled in when building with CAPTURE defined ('make CAPTURE=1').
+Otherwise the macros below expand to nothing.
+*/
+
+#ifndef CAPTURE_KEY_INTERVAL
+#define CAPTURE_KEY_INTERVAL 600        // Every this many sent frames is a key frame, which doesn't depend on the earlier ones, so a decoder started late can catch up.
+#endif
+
+#ifdef CAPTURE
+
+void capture_frame();
+void capture_drain();
+
+#define CAPTURE_FRAME() capture_frame()
+#define CAPTURE_DRAIN() capture_drain()
+
+#else
+
+#define CAPTURE_FRAME()
+#define CAPTURE_DRAIN()
+
+#endif
+
+#endif
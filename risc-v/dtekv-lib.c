@@ -1,12 +1,10 @@
+#include <stdint.h>
 #include "dtekv-lib.h"
-
-#define JTAG_UART ((volatile unsigned int*) 0x04000040)
-#define JTAG_CTRL ((volatile unsigned int*) 0x04000044)
+#include "hal.h"
 
 void printc(char s)
 {
-    while (((*JTAG_CTRL)&0xffff0000) == 0);
-    *JTAG_UART = s;
+    hal_putc(s);
 }
 
 void print(char *s)
@@ -61,7 +59,7 @@ void handle_exception ( unsigned arg0, unsigned arg1, unsigned arg2, unsigned ar
       break;
     case 11:
       if (syscall_num == 4)
-	print((char*) arg0); 
+	print((char*)(uintptr_t) arg0); 
       if (syscall_num == 11)
 	printc(arg0);
       return ;
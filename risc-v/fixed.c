@@ -0,0 +1,90 @@
+/*
+    fixed.c
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include <stdint.h>
+#include "fixed.h"
+
+/* sin(0°) to sin(90°) in steps of one degree. The rest of the circle is found through symmetry. */
+static const fixed sine_table[91] = {
+    0, 1144, 2287, 3430, 4572, 5712, 6850, 7987,
+    9121, 10252, 11380, 12505, 13626, 14742, 15855, 16962,
+    18064, 19161, 20252, 21336, 22415, 23486, 24550, 25607,
+    26656, 27697, 28729, 29753, 30767, 31772, 32768, 33754,
+    34729, 35693, 36647, 37590, 38521, 39441, 40348, 41243,
+    42126, 42995, 43852, 44695, 45525, 46341, 47143, 47930,
+    48703, 49461, 50203, 50931, 51643, 52339, 53020, 53684,
+    54332, 54963, 55578, 56175, 56756, 57319, 57865, 58393,
+    58903, 59396, 59870, 60326, 60764, 61183, 61584, 61966,
+    62328, 62672, 62997, 63303, 63589, 63856, 64104, 64332,
+    64540, 64729, 64898, 65048, 65177, 65287, 65376, 65446,
+    65496, 65526, 65536,
+};
+
+/**
+ * Returns the sine of the given angle.
+ * Parameter: degrees can be any angle, including negative ones.
+ */
+fixed fixed_sin(int degrees) {
+    degrees %= 360;
+    if (degrees < 0) degrees += 360;                    // Bring the angle into 0-359.
+
+    if (degrees <= 90) return sine_table[degrees];
+    if (degrees <= 180) return sine_table[180 - degrees];
+    if (degrees <= 270) return -sine_table[degrees - 180];
+    return -sine_table[360 - degrees];
+}
+
+/**
+ * Returns the cosine of the given angle.
+ * Parameter: degrees can be any angle, including negative ones.
+ */
+fixed fixed_cos(int degrees) {
+    return fixed_sin(degrees + 90);
+}
+
+/**
+ * Divides a by b, for 0 <= a <= b, i.e. when the result is between 0 and 1.
+ * Uses long division on 32-bit integers, since the board has no instruction for dividing 64-bit numbers.
+ */
+fixed fixed_fraction(fixed a, fixed b) {
+    if (a >= b) return FIXED_ONE;
+
+    uint32_t remainder = a;
+    uint32_t quotient = 0;
+    for (int i = 0; i < FIXED_SHIFT; i++) {             // One bit of the quotient per iteration.
+        remainder <<= 1;
+        quotient <<= 1;
+        if (remainder >= (uint32_t)b) {
+            remainder -= b;
+            quotient |= 1;
+        }
+    }
+    return (fixed)quotient;
+}
+
+/**
+ * Returns the length of the vector (x, y), i.e. sqrt(x*x + y*y).
+ * The square root is found one bit at a time, so it only needs integer operations.
+ */
+fixed fixed_length(fixed x, fixed y) {
+    uint64_t square = (uint64_t)((int64_t)x * x) + (uint64_t)((int64_t)y * y);     // Q32.32, so its square root is Q16.16.
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;                   // The highest power of four that fits in 64 bits.
+
+    while (bit > square) bit >>= 2;
+
+    while (bit != 0) {
+        if (square >= root + bit) {
+            square -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (fixed)root;
+}
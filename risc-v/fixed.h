@@ -0,0 +1,37 @@
+/*
+    fixed.h
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+/*
+Fixed-point numbers in Q16.16 format, i.e. 16 integer bits and 16 fractional bits.
+The board has no FPU, so they are used instead of float to give the ball sub-pixel positions and velocities.
+*/
+typedef int32_t fixed;
+
+#define FIXED_SHIFT 16
+#define FIXED_ONE (1 << FIXED_SHIFT)
+
+#define int_to_fixed(value) ((fixed)(value) * FIXED_ONE)
+#define fixed_to_int(value) ((int)((value) >> FIXED_SHIFT))   // Rounds towards negative infinity.
+
+/**
+ * Multiplies two fixed-point numbers. The intermediate product is 64 bits wide so that no precision is lost.
+ */
+static inline fixed fixed_mul(fixed a, fixed b) {
+    return (fixed)(((int64_t)a * b) >> FIXED_SHIFT);
+}
+
+fixed fixed_sin(int degrees);
+fixed fixed_cos(int degrees);
+fixed fixed_fraction(fixed a, fixed b);
+fixed fixed_length(fixed x, fixed y);
+
+#endif
@@ -0,0 +1,130 @@
+/*
+    font.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "font.h"
+#include "raster.h"
+
+#define first_glyph ' '
+#define last_glyph 'Z'
+
+/* 5x7 glyphs for the characters from space to Z. Each byte is one row, with the leftmost pixel in bit 4. Characters without a glyph are left empty. */
+static const unsigned char glyphs[last_glyph - first_glyph + 1][FONT_HEIGHT] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ' '
+    { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 },   // '!'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '"'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '#'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '$'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '%'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '&'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '\''
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '('
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ')'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '*'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ','
+    { 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00 },   // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c },   // '.'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '/'
+    { 0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e },   // '0'
+    { 0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e },   // '1'
+    { 0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f },   // '2'
+    { 0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e },   // '3'
+    { 0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02 },   // '4'
+    { 0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e },   // '5'
+    { 0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e },   // '6'
+    { 0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },   // '7'
+    { 0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e },   // '8'
+    { 0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c },   // '9'
+    { 0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00 },   // ':'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ';'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '<'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '='
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '>'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '?'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '@'
+    { 0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11 },   // 'A'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e },   // 'B'
+    { 0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e },   // 'C'
+    { 0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c },   // 'D'
+    { 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f },   // 'E'
+    { 0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10 },   // 'F'
+    { 0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f },   // 'G'
+    { 0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11 },   // 'H'
+    { 0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e },   // 'I'
+    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c },   // 'J'
+    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },   // 'K'
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f },   // 'L'
+    { 0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11 },   // 'M'
+    { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },   // 'N'
+    { 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e },   // 'O'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10 },   // 'P'
+    { 0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d },   // 'Q'
+    { 0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11 },   // 'R'
+    { 0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e },   // 'S'
+    { 0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },   // 'T'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e },   // 'U'
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04 },   // 'V'
+    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a },   // 'W'
+    { 0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11 },   // 'X'
+    { 0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04 },   // 'Y'
+    { 0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f },   // 'Z'
+};
+
+/**
+ * Returns the width in pixels of the text when drawn at the given scale.
+ */
+int text_width(const char *text, int scale) {
+    int length = 0;
+    while (text[length] != '\0') length++;
+    return length ? (length * (FONT_WIDTH + FONT_SPACING) - FONT_SPACING) * scale : 0;
+}
+
+/**
+ * Returns one row of the glyph of a character, with the leftmost pixel in bit FONT_WIDTH - 1.
+ * Parameter: row is between 0 and FONT_HEIGHT - 1.
+ */
+int font_row(char character, int row) {
+    if (character >= 'a' && character <= 'z') character -= 'a' - 'A';
+    if (character < first_glyph || character > last_glyph) return 0;   // Drawn as a space.
+    return glyphs[character - first_glyph][row];
+}
+
+/**
+ * Draws a character with its top left corner at (x, y). Every pixel of the glyph box is written, so whatever was there before is replaced.
+ * Each row of the glyph is written as a few spans of equal color instead of pixel by pixel.
+ */
+static void draw_char(int x, int y, char character, int scale, char color, char background) {
+    for (int row = 0; row < FONT_HEIGHT; row++, y += scale) {
+        int bits = font_row(character, row);
+        int column = 0;
+        while (column < FONT_WIDTH) {                       // One span per run of set or cleared bits.
+            int on = (bits >> (FONT_WIDTH - 1 - column)) & 1;
+            int end = column + 1;
+            while (end < FONT_WIDTH && ((bits >> (FONT_WIDTH - 1 - end)) & 1) == on) end++;
+            fill_rect(x + column * scale, y, (end - column) * scale, scale, on ? color : background);
+            column = end;
+        }
+    }
+}
+
+/**
+ * Draws the text with its top left corner at (x, y), each font pixel as a square of scale x scale screen pixels.
+ * The gaps between the characters are filled with the background color, so the text replaces what was drawn in its box.
+ * Returns the width of the text in pixels.
+ */
+int draw_text(int x, int y, const char *text, int scale, char color, char background) {
+    int start = x;
+    for (int i = 0; text[i] != '\0'; i++) {
+        if (i > 0) {
+            fill_rect(x, y, FONT_SPACING * scale, FONT_HEIGHT * scale, background);
+            x += FONT_SPACING * scale;
+        }
+        draw_char(x, y, text[i], scale, color, background);
+        x += FONT_WIDTH * scale;
+    }
+    return x - start;
+}
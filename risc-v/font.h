@@ -0,0 +1,21 @@
+/*
+    font.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef FONT_H
+#define FONT_H
+
+/* Bitmap font with 5x7 pixel glyphs for digits, upper case letters and a few symbols. Lower case letters are drawn as upper case. */
+
+#define FONT_WIDTH 5
+#define FONT_HEIGHT 7
+#define FONT_SPACING 1                  // Empty columns between two characters.
+
+int font_row(char character, int row);
+int text_width(const char *text, int scale);
+int draw_text(int x, int y, const char *text, int scale, char color, char background);
+
+#endif
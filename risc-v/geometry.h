@@ -0,0 +1,48 @@
+/*
+    geometry.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+/*
+Geometry of the playing field and the screen. The game is played on a field of FIELD_WIDTH x FIELD_HEIGHT units in every build,
+so the physics, the computer players and the tuning values don't depend on the resolution. Each unit is drawn as SCREEN_SCALE x SCREEN_SCALE pixels.
+The resolution is chosen when building, with 'make RESOLUTION=640' for 640x480, and is 320x240 by default, where a unit is a pixel.
+Every pixel is one byte in RGB332.
+*/
+
+#ifndef RESOLUTION
+#define RESOLUTION 320
+#endif
+
+#if RESOLUTION == 320
+#define SCREEN_SCALE_SHIFT 0
+#elif RESOLUTION == 640
+#define SCREEN_SCALE_SHIFT 1
+#else
+#error "RESOLUTION must be 320 or 640"
+#endif
+
+#define FIELD_WIDTH 320
+#define FIELD_HEIGHT 240
+
+#define SCREEN_SCALE (1 << SCREEN_SCALE_SHIFT)
+#define SCREEN_WIDTH (FIELD_WIDTH << SCREEN_SCALE_SHIFT)
+#define SCREEN_HEIGHT (FIELD_HEIGHT << SCREEN_SCALE_SHIFT)
+#define SCREEN_PIXELS (SCREEN_WIDTH * SCREEN_HEIGHT)
+
+#define TO_SCREEN(units) ((units) * SCREEN_SCALE)                   // Converts a length or a position on the field to pixels.
+
+/* Offset of the first pixel of row y in the framebuffer. A row is 5 << (6 + SCREEN_SCALE_SHIFT) pixels, so this is two shifts and an add. */
+#define SCREEN_ROW(y) (((y) << (8 + SCREEN_SCALE_SHIFT)) + ((y) << (6 + SCREEN_SCALE_SHIFT)))
+
+/* The paddles, in field units */
+#define PLAYER_POSITION 8               // Distance from the left and right borders to the paddles of players 1 and 2.
+#define PLAYER_WIDTH 5
+#define HORIZONTAL_POSITION 24          // Distance from the top and bottom borders to the paddles of players 3 and 4, which leaves room for the texts.
+
+#endif
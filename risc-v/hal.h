@@ -0,0 +1,126 @@
+/*
+    hal.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef HAL_H
+#define HAL_H
+
+/*
+Hardware abstraction layer. Every access to the devices on the board goes through the pointers and functions in this file.
+When built for the DTEK-V board they are the memory mapped devices and CSR instructions themselves.
+When built with -DHOST, for running the game natively on Linux, they are stand-ins in memory that host/hal-host.c drives instead.
+*/
+
+#ifdef HOST
+
+extern volatile int host_switches[4];
+extern volatile int host_button[4];
+extern volatile int host_timer[8];
+extern volatile int host_displays[6 * 4];
+extern volatile int host_vga_ctrl[4];
+extern volatile char host_vga_memory[];
+
+#define SWITCHES ((volatile int*) host_switches)
+#define BUTTON ((volatile int*) host_button)
+#define TIMER ((volatile int*) host_timer)
+#define DISPLAYS ((volatile int*) host_displays)
+#define VGA_DMA ((volatile int*) host_vga_ctrl)
+#define VGA_MEMORY ((volatile char*) host_vga_memory)
+
+#define HAL_CYCLES_PER_SECOND 1000000000  // hal_cycles() counts nanoseconds on the host.
+#define HAL_CLOCK_PER_SECOND 30000000     // hal_clock() counts the cycles of the virtual clock that the timer runs on.
+
+unsigned int hal_cycles(void);
+unsigned int hal_clock(void);
+unsigned int hal_instructions(void);
+void hal_disable_interrupts(void);
+void hal_enable_interrupts(void);
+void hal_wait_for_interrupt(void);
+void hal_putc(char c);
+unsigned int hal_uart_space(void);
+void hal_uart_interrupt(int on);
+
+#else
+
+#define SWITCHES ((volatile int*) 0x04000010)      // Toggle-switches: data, direction, interrupt mask, edge capture.
+#define BUTTON ((volatile int*) 0x040000d0)        // Second push-button: data, direction, interrupt mask, edge capture.
+#define TIMER ((volatile int*) 0x04000020)         // Timer: status, control, periodL, periodH, snapL, snapH.
+#define DISPLAYS ((volatile int*) 0x04000050)      // 7-segment displays, four words apart.
+#define VGA_DMA ((volatile int*) 0x04000100)       // VGA controller: buffer, back buffer, resolution, status.
+#define VGA_MEMORY ((volatile char*) 0x08000000)   // Pixel memory of the VGA output.
+
+#define JTAG_UART ((volatile unsigned int*) 0x04000040)
+#define JTAG_CTRL ((volatile unsigned int*) 0x04000044)   // Control register: write interrupt enable in bit 1, free space in the write FIFO in bits 16-31.
+
+#define HAL_CYCLES_PER_SECOND 30000000    // The clock frequency of the processor.
+
+/**
+ * Returns the number of clock cycles since the processor started, from the mcycle register.
+ */
+static inline unsigned int hal_cycles(void) {
+    unsigned int cycles;
+    asm volatile ("csrr %0, mcycle" : "=r"(cycles));
+    return cycles;
+}
+
+#define HAL_CLOCK_PER_SECOND HAL_CYCLES_PER_SECOND
+
+/**
+ * Returns the time of the clock that the timer runs on, for timing the input. On the board that is the cycle counter.
+ */
+static inline unsigned int hal_clock(void) {
+    return hal_cycles();
+}
+
+/**
+ * Returns the number of instructions that the processor has completed, from the minstret register.
+ */
+static inline unsigned int hal_instructions(void) {
+    unsigned int instructions;
+    asm volatile ("csrr %0, minstret" : "=r"(instructions));
+    return instructions;
+}
+
+static inline void hal_disable_interrupts(void) {
+    asm volatile ("csrci mstatus, 8");
+}
+
+static inline void hal_enable_interrupts(void) {
+    asm volatile ("csrsi mstatus, 8");
+}
+
+/**
+ * Sleeps until an interrupt is pending. Also wakes up when interrupts are disabled globally.
+ */
+static inline void hal_wait_for_interrupt(void) {
+    asm volatile ("wfi");
+}
+
+/**
+ * Writes a character to the JTAG UART, waiting until there is space for it.
+ */
+static inline void hal_putc(char c) {
+    while (((*JTAG_CTRL)&0xffff0000) == 0);
+    *JTAG_UART = c;
+}
+
+/**
+ * Returns the number of characters that can be written to the JTAG UART without waiting.
+ */
+static inline unsigned int hal_uart_space(void) {
+    return *JTAG_CTRL >> 16;
+}
+
+/**
+ * Turns the write interrupt of the JTAG UART on or off. While it is on, the UART interrupts whenever it has space for more characters.
+ */
+static inline void hal_uart_interrupt(int on) {
+    *JTAG_CTRL = on ? 2 : 0;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,94 @@
+/*
+    bench-balls.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Stress benchmark for the ball pool. Keeps 1, 8, 16, 32 and BALL_CAPACITY balls in play for a number of steps each and reports
+the clock cycles of move_balls and draw_balls per step and per ball, so that it is easy to see that both grow linearly with the number of balls.
+The cycles are read from the time-stamp counter on x86. On other hosts the columns are in nanoseconds instead.
+Usage: bench-balls [steps]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "../geometry.h"
+#include "../hal.h"
+#include "../pong.h"
+#include "../render.h"
+#include "../tuning.h"
+
+#define serve_x int_to_fixed(FIELD_WIDTH/2)      // The center of the field, where pong.c serves the balls from.
+#define serve_y int_to_fixed(FIELD_HEIGHT/2)
+#define serve_velocity per_step(BALL_VELOCITY)  // The speed of a newly served ball.
+
+/**
+ * Returns the time-stamp counter, or the time in nanoseconds where there is none.
+ */
+static long long now_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return (long long)__rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ll + now.tv_nsec;
+#endif
+}
+
+/**
+ * Serves new balls from the center of the screen until there are count balls in play.
+ * Each one gets its own angle, so that they spread out over the screen.
+ */
+static void top_up(int count, int *serves) {
+    while (ball_count < count) {
+        int ball = spawn_ball(serve_x, serve_y, serve_velocity, 0);
+        if (ball < 0) return;
+
+        rotate_ball_vector_counter_clockwise(ball, (*serves * 37) % 90 - 45);
+        if (*serves % 2) ball_dx[ball] = -ball_dx[ball];
+        (*serves)++;
+    }
+}
+
+int main(int argc, char **argv) {
+    long steps = argc > 1 ? strtol(argv[1], NULL, 0) : 10000;
+    if (steps <= 0) steps = 1;
+
+    static const int counts[] = { 1, 8, 16, 32, BALL_CAPACITY };
+
+    printf("%6s %14s %14s %14s %14s\n", "balls", "move cyc/step", "move cyc/ball", "draw cyc/step", "draw cyc/ball");
+    for (int i = 0; i < (int)(sizeof counts / sizeof counts[0]); i++) {
+        int count = counts[i] < BALL_CAPACITY ? counts[i] : BALL_CAPACITY;
+        if (i > 0 && count == counts[i - 1]) break;
+
+        int serves = 0;
+        long long move = 0, draw = 0;
+
+        initialize_game();
+        for (long step = 0; step < steps; step++) {
+            top_up(count, &serves);
+
+            long long start = now_cycles();
+            move_balls();
+            move += now_cycles() - start;
+
+            reset_screen();
+            start = now_cycles();
+            draw_balls();
+            draw += now_cycles() - start;
+            present_frame();
+        }
+
+        printf("%6d %14.1f %14.1f %14.1f %14.1f\n", count,
+            (double)move / steps, (double)move / steps / count,
+            (double)draw / steps, (double)draw / steps / count);
+    }
+    printf("%ld steps per row\n", steps);
+    return 0;
+}
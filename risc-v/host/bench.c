@@ -0,0 +1,117 @@
+/*
+    bench.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Headless frame-time benchmark. Runs the stages of the game loop for a number of frames on the host and reports the average time per frame of each stage.
+The parts of render_frame() are timed in a second run of the same frames, so the total only counts the stages the game runs.
+Usage: bench [frames]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../ai.h"
+#include "../hal.h"
+#include "../input.h"
+#include "../pong.h"
+#include "../render.h"
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    long long total;            // Nanoseconds spent in the stage over all frames.
+} stage;
+
+/* The stages of a frame of the game loop, in the order the game runs them. */
+static stage game_stages[] = {
+    { "input_poll", input_poll, 0 },
+    { "set_special_game_modes", set_special_game_modes, 0 },
+    { "set_paddles_velocity", set_paddles_velocity, 0 },
+    { "ai_update", ai_update, 0 },
+    { "move_balls", move_balls, 0 },
+    { "move_paddles", move_paddles, 0 },
+    { "render_frame", render_frame, 0 },
+    { "present_frame", present_frame, 0 },
+};
+
+/* The parts of render_frame(), which are measured in a loop of their own since render_frame() already runs them. */
+static stage render_stages[] = {
+    { "compose_frame", compose_frame, 0 },
+    { "draw_balls", draw_balls, 0 },
+    { "draw_paddles", draw_paddles, 0 },
+    { "draw_texts", draw_texts, 0 },
+};
+
+#define stage_count(stages) ((int)(sizeof stages / sizeof stages[0]))
+
+static long long now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000000ll + now.tv_nsec;
+}
+
+/**
+ * Returns the switch word for the given frame. Both players change direction every 20 frames and MEGA-BALL is toggled every 500 frames, so that both the incremental and the full redraw paths are measured.
+ */
+static int scripted_switches(long frame) {
+    int switches = (frame / 20) % 2 ? 0b0100000001 : 0b1000000010;
+    if ((frame / 500) % 2) switches |= 0b1000;
+    return switches;
+}
+
+/**
+ * Runs the given stages in order, adding the time of each one to its total.
+ */
+static void run_timed(stage *stages, int count) {
+    for (int i = 0; i < count; i++) {
+        long long start = now_ns();
+        stages[i].run();
+        stages[i].total += now_ns() - start;
+    }
+}
+
+/**
+ * Prints the average time per frame of each of the given stages, and their sum if total is 1.
+ */
+static void report(stage *stages, int count, long frames, int total) {
+    long long sum = 0;
+    for (int i = 0; i < count; i++) {
+        printf("%-24s %12.1f\n", stages[i].name, (double)stages[i].total / frames);
+        sum += stages[i].total;
+    }
+    if (total) printf("%-24s %12.1f\n", "total", (double)sum / frames);
+}
+
+int main(int argc, char **argv) {
+    long frames = argc > 1 ? strtol(argv[1], NULL, 0) : 10000;
+    if (frames <= 0) frames = 1;
+
+    /* The game loop, with the same frames as the game. */
+    initialize_game();
+    for (long frame = 0; frame < frames; frame++) {
+        host_switches[0] = scripted_switches(frame);
+        if (game_state != GAME_RUNNING) initialize_game();             // Keep playing after a player has won.
+        run_timed(game_stages, stage_count(game_stages));
+    }
+
+    /* The same game again, with the parts of render_frame() run and timed one by one in place of it. */
+    initialize_game();
+    for (long frame = 0; frame < frames; frame++) {
+        host_switches[0] = scripted_switches(frame);
+        if (game_state != GAME_RUNNING) initialize_game();
+        for (int i = 0; i < stage_count(game_stages) - 2; i++) game_stages[i].run();   // Everything before render_frame(), untimed.
+        run_timed(render_stages, stage_count(render_stages));
+        present_frame();
+    }
+
+    printf("%-24s %12s\n", "stage", "ns/frame");
+    report(game_stages, stage_count(game_stages), frames, 1);
+    printf("in render_frame:\n");
+    report(render_stages, stage_count(render_stages), frames, 0);
+    printf("%ld frames\n", frames);
+    return 0;
+}
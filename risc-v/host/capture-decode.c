@@ -0,0 +1,234 @@
+/*
+    capture-decode.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Rebuilds the frames that a 'make CAPTURE=1' build sends over the JTAG UART, see capture.c for the format.
+Reads the output of the board, or of host/pong, and skips every line that isn't part of a captured frame.
+Each frame is checked against its checksum. After a frame that doesn't match, or one that is missing lines, the frames are skipped until the next key frame.
+The frames are written as PPM images, either to numbered files or one after the other to the standard output, which ffmpeg can make a video of:
+    capture-decode uart.txt | ffmpeg -f image2pipe -c:v ppm -framerate 60 -i - capture.mp4
+Usage: capture-decode [-o prefix] [input]
+  -o  Write each frame to <prefix><frame>.ppm instead, where <frame> is its number in the output of the board.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static int width = 0, height = 0;
+static unsigned char *reference = NULL;         // The last frame that was rebuilt.
+static unsigned char *frame = NULL;             // The frame being rebuilt.
+static int synced = 0;                          // 1 while reference is the frame that the next delta frame was XORed with.
+
+/* The frame being read */
+static int open_frame = 0;                      // 1 between a cap line and its cape line.
+static unsigned int number = 0;
+static int key = 0;
+static unsigned char *runs = NULL;              // The decoded capd lines of the frame.
+static size_t run_bytes = 0, run_capacity = 0;
+
+/* Statistics */
+static long frames_written = 0, key_frames = 0, frames_left_out = 0, frames_skipped = 0, bad_frames = 0;
+static long long capture_characters = 0;
+static unsigned int last_number = 0;
+
+static const char *prefix = NULL;
+
+/**
+ * Decodes a line of base64 and adds the bytes to runs. Returns 0 if it isn't valid base64.
+ */
+static int add_base64(const char *text) {
+    static const char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    unsigned int group = 0;
+    int bits = 0;
+    for (; *text != '\0' && *text != '\n' && *text != '\r'; text++) {
+        if (*text == '=') break;
+        const char *digit = strchr(digits, *text);
+        if (!digit) return 0;
+        group = (group << 6) | (unsigned int)(digit - digits);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if (run_bytes == run_capacity) {
+                run_capacity = run_capacity ? 2 * run_capacity : 4096;
+                runs = realloc(runs, run_capacity);
+            }
+            runs[run_bytes++] = (unsigned char)(group >> bits);
+        }
+    }
+    return 1;
+}
+
+/**
+ * Reads a number of the runs, 7 bits at a time from the lowest. Returns 0 if the runs end in the middle of it.
+ */
+static int read_number(size_t *at, unsigned int *value) {
+    *value = 0;
+    for (int shift = 0; *at < run_bytes && shift < 32; shift += 7) {
+        unsigned char byte = runs[(*at)++];
+        *value |= (unsigned int)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Applies the runs to the reference frame or, for a key frame, to a black one. Returns 0 if they don't fit in the frame.
+ */
+static int apply_runs(void) {
+    size_t pixels = (size_t)width * height;
+    if (key) memset(frame, 0, pixels);
+    else memcpy(frame, reference, pixels);
+
+    size_t at = 0, pixel = 0;
+    while (at < run_bytes) {
+        unsigned int skip, length;
+        if (!read_number(&at, &skip) || !read_number(&at, &length) || at >= run_bytes) return 0;
+        unsigned char value = runs[at++];
+        if (pixel + skip + length > pixels) return 0;
+        pixel += skip;
+        for (unsigned int i = 0; i < length; i++) frame[pixel++] ^= value;
+    }
+    return 1;
+}
+
+/**
+ * Returns the checksum of the rebuilt frame, computed like capture_frame() does on the board.
+ */
+static unsigned int frame_checksum(void) {
+    uint32_t sum = 0;
+    for (size_t i = 0; i + 3 < (size_t)width * height; i += 4) {
+        uint32_t word = frame[i] | frame[i + 1] << 8 | frame[i + 2] << 16 | (uint32_t)frame[i + 3] << 24;
+        sum = ((sum << 1) | (sum >> 31)) ^ word;
+    }
+    return sum;
+}
+
+/**
+ * Writes the rebuilt frame as a PPM image, converting the RGB332 pixels to 24-bit color like the screenshots of host/pong.
+ */
+static void write_frame(void) {
+    FILE *file = stdout;
+    char path[4096];
+    if (prefix) {
+        snprintf(path, sizeof path, "%s%06u.ppm", prefix, number);
+        file = fopen(path, "wb");
+        if (!file) {
+            perror(path);
+            exit(1);
+        }
+    }
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for (size_t i = 0; i < (size_t)width * height; i++) {
+        unsigned char pixel = frame[i];
+        unsigned char rgb[3] = {
+            (unsigned char)(((pixel >> 5) & 7) * 255 / 7),
+            (unsigned char)(((pixel >> 2) & 7) * 255 / 7),
+            (unsigned char)((pixel & 3) * 255 / 3),
+        };
+        fwrite(rgb, 1, 3, file);
+    }
+    if (prefix) fclose(file);
+    frames_written++;
+}
+
+/**
+ * Starts reading a frame from its cap line.
+ */
+static void begin_frame(const char *line) {
+    int frame_width, frame_height;
+    if (open_frame) synced = 0;                 // The previous frame never ended, so lines have been lost.
+    if (sscanf(line, "cap %u %d %d %d", &number, &key, &frame_width, &frame_height) != 4 || frame_width <= 0 || frame_height <= 0) {
+        open_frame = 0;
+        synced = 0;
+        return;
+    }
+    if (frame_width != width || frame_height != height) {
+        width = frame_width;
+        height = frame_height;
+        reference = realloc(reference, (size_t)width * height);
+        frame = realloc(frame, (size_t)width * height);
+        memset(reference, 0, (size_t)width * height);
+        synced = 0;
+    }
+    open_frame = 1;
+    run_bytes = 0;
+}
+
+/**
+ * Finishes a frame at its cape line, and writes it if it could be rebuilt.
+ */
+static void end_frame(const char *line) {
+    unsigned int end_number, checksum;
+    if (!open_frame) return;
+    open_frame = 0;
+    if (sscanf(line, "cape %u %x", &end_number, &checksum) != 2 || end_number != number) {
+        synced = 0;
+        return;
+    }
+    if (key) {
+        key_frames++;
+    } else if (!synced) {
+        frames_skipped++;                       // Waiting for a key frame.
+        return;
+    }
+
+    if (!apply_runs() || frame_checksum() != checksum) {
+        fprintf(stderr, "capture-decode: frame %u doesn't match its checksum, waiting for the next key frame\n", number);
+        bad_frames++;
+        synced = 0;
+        return;
+    }
+    memcpy(reference, frame, (size_t)width * height);
+    synced = 1;
+    if (last_number && number > last_number + 1) frames_left_out += number - last_number - 1;
+    last_number = number;
+    write_frame();
+}
+
+int main(int argc, char **argv) {
+    int option;
+    while ((option = getopt(argc, argv, "o:")) != -1) {
+        if (option == 'o') {
+            prefix = optarg;
+        } else {
+            fprintf(stderr, "usage: capture-decode [-o prefix] [input]\n");
+            return 2;
+        }
+    }
+    FILE *input = stdin;
+    if (optind < argc) {
+        input = fopen(argv[optind], "r");
+        if (!input) {
+            perror(argv[optind]);
+            return 1;
+        }
+    }
+
+    char line[4096];
+    while (fgets(line, sizeof line, input)) {
+        if (strncmp(line, "cap", 3) != 0) continue;
+        if (strncmp(line, "cap ", 4) == 0) {
+            begin_frame(line);
+        } else if (strncmp(line, "capd ", 5) == 0) {
+            if (open_frame && !add_base64(line + 5)) synced = 0;
+        } else if (strncmp(line, "cape ", 5) == 0) {
+            end_frame(line);
+        } else {
+            continue;
+        }
+        capture_characters += strlen(line);
+    }
+
+    fprintf(stderr, "%ld frames written (%ld key frames), %ld left out by the board, %ld skipped waiting for a key frame, %ld didn't match\n",
+        frames_written, key_frames, frames_left_out, frames_skipped, bad_frames);
+    fprintf(stderr, "%lld characters of captured frames, %.0f per frame\n", capture_characters,
+        frames_written ? (double)capture_characters / frames_written : 0.0);
+    return bad_frames ? 1 : 0;
+}
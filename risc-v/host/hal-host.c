@@ -0,0 +1,238 @@
+/*
+    hal-host.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Stand-ins for the devices on the DTEK-V board, so that the game can run natively and headless on Linux.
+The devices are plain arrays in memory and the timer is virtual: each time the game sleeps waiting for an interrupt, time jumps forward by one timer period.
+The VGA controller completes a requested swap at the next virtual vertical sync, 60 times per second.
+
+The run is controlled with environment variables:
+- PONG_TICKS: Number of timer periods, i.e. physics steps, to run before exiting. Defaults to one minute of game time.
+- PONG_INPUT: File with scripted input. Each line is "<tick> <switches> [<button>]", and the values are used from that tick until the next line.
+- PONG_SCREENSHOT: File to write the last presented frame to, as a PPM image.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../geometry.h"
+#include "../hal.h"
+#include "../irq.h"
+#include "../log.h"
+#include "../pong.h"
+
+#define max_script_lines 4096
+#define clock_frequency HAL_CLOCK_PER_SECOND
+#define refresh_rate 60
+
+volatile int host_switches[4];
+volatile int host_button[4];
+volatile int host_timer[8];
+volatile int host_displays[6 * 4];
+volatile int host_vga_ctrl[4];
+volatile char host_vga_memory[2 * SCREEN_PIXELS] __attribute__((aligned(4)));
+
+/* Interrupt state */
+static unsigned int interrupt_mask = 0;     // Stand-in for the mie register.
+static int interrupts_enabled = 0;          // Stand-in for the MIE bit of mstatus.
+static int switch_edges = 0;                // Changes of the switches and the push-button that haven't been delivered as interrupts yet.
+static int button_edges = 0;
+
+/* Run state */
+static long ticks = 0;
+static long tick_limit = 60 * PHYSICS_HZ;
+static long long virtual_time = 0;          // Clock cycles since the start.
+static long frames = 0;                     // Frames presented to the VGA controller.
+static int presented = 0;                   // The back buffer register value of the last presented frame.
+
+/* Scripted input */
+typedef struct {
+    long tick;
+    int switches;
+    int button;
+} script_line;
+
+static script_line script[max_script_lines];
+static int script_length = 0;
+static int script_position = 0;
+
+/**
+ * Reads the environment variables and the input script before main() starts.
+ */
+__attribute__((constructor))
+static void host_setup(void) {
+    const char *value = getenv("PONG_TICKS");
+    if (value) tick_limit = strtol(value, NULL, 0);
+
+    const char *path = getenv("PONG_INPUT");
+    if (path) {
+        FILE *file = fopen(path, "r");
+        if (!file) {
+            perror(path);
+            exit(1);
+        }
+        char line[256];
+        while (script_length < max_script_lines && fgets(line, sizeof line, file)) {
+            script_line *entry = &script[script_length];
+            char *end;
+            entry->tick = strtol(line, &end, 0);
+            if (end == line) continue;                  // Skip empty lines and comments.
+            entry->switches = (int)strtol(end, &end, 0);
+            entry->button = (int)strtol(end, &end, 0);
+            script_length++;
+        }
+        fclose(file);
+    }
+}
+
+/**
+ * Writes the framebuffer that was last handed to the VGA controller to a PPM file, converting the RGB332 pixels to 24-bit color.
+ */
+static void write_screenshot(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        perror(path);
+        return;
+    }
+    unsigned int offset = (unsigned int)host_vga_ctrl[1] - (unsigned int)(uintptr_t)host_vga_memory;   // The register only holds the low 32 bits of the address.
+    if (offset >= sizeof host_vga_memory) offset = 0;   // Nothing has been presented yet.
+
+    fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (int i = 0; i < SCREEN_PIXELS; i++) {
+        unsigned char pixel = (unsigned char)host_vga_memory[offset + i];
+        unsigned char rgb[3] = {
+            (unsigned char)(((pixel >> 5) & 7) * 255 / 7),
+            (unsigned char)(((pixel >> 2) & 7) * 255 / 7),
+            (unsigned char)((pixel & 3) * 255 / 3),
+        };
+        fwrite(rgb, 1, 3, file);
+    }
+    fclose(file);
+}
+
+/**
+ * Ends the run once the tick limit has been reached.
+ */
+static void finish(void) {
+    static const char *state_names[] = { "over", "running", "paused", "title" };   // Indexed by game_state.
+
+    const char *path = getenv("PONG_SCREENSHOT");
+    if (path) write_screenshot(path);
+
+    while (log_drain() > 0);                            // Write out what is still waiting in the log.
+
+    printf("ticks: %ld  frames: %ld (%.1f fps)  score: ", ticks, frames, frames * (double)clock_frequency / (virtual_time ? virtual_time : 1));
+    for (int player = 0; player < PLAYERS; player++) printf(player ? "-%d" : "%d", player_scores[player]);
+    printf("  time: %02d:%02d  game: %s\n", minutes, seconds, state_names[game_state]);
+    exit(0);
+}
+
+/**
+ * Returns the number of nanoseconds since an arbitrary point, used in place of the mcycle register.
+ */
+unsigned int hal_cycles(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned int)(now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+/**
+ * Returns the virtual time in clock cycles. It only moves forward while the game sleeps, so the scripted input is timed the same however fast the host is.
+ */
+unsigned int hal_clock(void) {
+    return (unsigned int)virtual_time;
+}
+
+/**
+ * There is no instruction counter on the host, so the profiler reports 0 instructions.
+ */
+unsigned int hal_instructions(void) {
+    return 0;
+}
+
+/**
+ * Calls the registered interrupt handler for every device that has an enabled interrupt pending, like the vectored entries in boot.S.
+ * The scripted input changes at the same time as the timer times out, and its interrupts are delivered first, as if it changed just before.
+ * The edge-capture registers are cleared when their interrupt is delivered, so the handlers don't need to clear them.
+ */
+static void deliver_interrupts(void) {
+    if (!interrupts_enabled) return;
+    if ((interrupt_mask & (1 << IRQ_SWITCHES)) && (switch_edges & host_switches[2])) {
+        host_switches[3] = switch_edges;
+        switch_edges = 0;
+        interrupt_handlers[IRQ_SWITCHES](IRQ_SWITCHES);
+    }
+    if ((interrupt_mask & (1 << IRQ_BUTTON)) && (button_edges & host_button[2])) {
+        host_button[3] = button_edges;
+        button_edges = 0;
+        interrupt_handlers[IRQ_BUTTON](IRQ_BUTTON);
+    }
+    if ((interrupt_mask & (1 << IRQ_TIMER)) && (host_timer[1] & 1) && (host_timer[0] & 1)) interrupt_handlers[IRQ_TIMER](IRQ_TIMER);
+}
+
+void hal_disable_interrupts(void) {
+    interrupts_enabled = 0;
+}
+
+void hal_enable_interrupts(void) {
+    interrupts_enabled = 1;
+    deliver_interrupts();
+}
+
+/**
+ * Advances the virtual time by one timer period, which makes the timer time out and applies the scripted input for the new tick.
+ * A swap requested since the last call completes if a vertical sync happens during the period.
+ */
+void hal_wait_for_interrupt(void) {
+    if (host_vga_ctrl[1] != presented) {                // A new frame was handed to the VGA controller.
+        presented = host_vga_ctrl[1];
+        host_vga_ctrl[3] |= 1;
+        frames++;
+    }
+
+    if (ticks >= tick_limit) finish();
+    ticks++;
+
+    long long period = (((host_timer[3] & 0xffff) << 16) | (host_timer[2] & 0xffff)) + 1;
+    long long vsync_period = clock_frequency / refresh_rate;
+    if ((virtual_time + period) / vsync_period != virtual_time / vsync_period) host_vga_ctrl[3] &= ~1;
+    virtual_time += period;
+
+    while (script_position < script_length && script[script_position].tick <= ticks) {
+        switch_edges |= host_switches[0] ^ script[script_position].switches;
+        button_edges |= host_button[0] ^ script[script_position].button;
+        host_switches[0] = script[script_position].switches;
+        host_button[0] = script[script_position].button;
+        script_position++;
+    }
+
+    if (host_timer[1] & 4) host_timer[0] |= 1;          // Time out if the timer has been started.
+}
+
+void hal_putc(char c) {
+    putchar(c);
+}
+
+/**
+ * Standard output never makes the game wait, so there is always space for a FIFO's worth of characters.
+ */
+unsigned int hal_uart_space(void) {
+    return 64;
+}
+
+void hal_uart_interrupt(int on) {
+    (void)on;
+}
+
+/**
+ * Host version of enable_interrupt in boot.S.
+ */
+void enable_interrupt(unsigned int mask) {
+    interrupt_mask |= mask;
+    hal_enable_interrupts();
+}
@@ -0,0 +1,791 @@
+/*
+    iss.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Instruction-set simulator for benchmarking main.elf without the board. Runs the unmodified rv32im program for a number of timer ticks,
+with stand-ins for the timer, the switches, the push-button, the 7-segment displays, the JTAG UART and the VGA controller at their DTEK-V addresses.
+Counts the retired instructions and memory stores of every function named in main.elf.txt, both including and excluding the functions it calls,
+and compares them with a baseline so that a change that makes the game loop slower is caught without a board.
+
+Every instruction takes one clock cycle. When the program sleeps with wfi, or spins on the timer, the VGA status, the switches or the push-button,
+time jumps forward to the next timer timeout or vertical sync, so the counts don't depend on how long the program waits.
+The input is scripted like for host/pong: each line of the input file is "<tick> <switches> [<button>]".
+The calls are followed on a shadow call stack. A function that is jumped to without a call, like with a tail call, takes over the frame of the function it came from.
+The exit status is 2 if a function comes out with more instructions by itself than including its calls, which would mean that the stack lost track.
+
+Usage: iss [-t ticks] [-i input] [-b baseline] [-r percent] [-w baseline] [-u] main.elf main.elf.txt
+  -t  Number of timer ticks to run (600).
+  -i  Scripted input.
+  -b  Baseline to compare with. The exit status is 1 if a function has more than -r percent (2) more instructions or stores than in it.
+  -w  Write the counts of this run as a new baseline.
+  -u  Show what the program writes to the JTAG UART.
+*/
+
+#include <elf.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define ram_size 0x02000000u                    // Memory from address 0, for the program, its data and its stack.
+#define vga_base 0x08000000u
+#define vga_size 0x00100000u
+#define io_base 0x04000000u
+#define io_size 0x00000200u
+
+#define clock_frequency 30000000
+#define vsync_period (clock_frequency / 60)
+#define spin_window 64                          // A register that the same instruction reads again within this many instructions is being spun on.
+#define spin_slots 64
+#define max_depth 256                           // Depth of the shadow call stack.
+#define max_script_lines 4096
+
+/* Interrupt causes, as in irq.h */
+#define irq_timer 16
+#define irq_switches 17
+#define irq_button 18
+
+/* Machine state */
+static uint32_t x[32];
+static uint32_t pc;
+static uint8_t *ram;
+static uint8_t *vga;
+static uint64_t cycles = 0;
+static uint64_t instret = 0;
+static uint64_t stores = 0;
+static uint32_t mstatus = 0, mie = 0, mtvec = 0, mepc = 0, mcause = 0, mscratch = 0, mtval = 0;
+
+/* Devices */
+static uint32_t timer_status = 0;               // TO in bit 0, RUN in bit 1.
+static uint32_t timer_control = 0;              // ITO in bit 0, CONT in bit 1.
+static uint32_t timer_period = 0xffffffff;      // periodH and periodL.
+static uint64_t next_timeout = UINT64_MAX;
+static uint64_t next_vsync = vsync_period;
+static uint32_t switches = 0, switch_mask = 0, switch_edges = 0;
+static uint32_t button = 0, button_mask = 0, button_edges = 0;
+static uint32_t vga_buffer = vga_base, vga_back_buffer = vga_base, vga_swap_pending = 0;
+static int show_uart = 0;
+
+/* Run state */
+static long ticks = 0;
+static long tick_limit = 600;
+static uint32_t busy_pc[spin_slots];            // Instructions that recently read a busy status register or an input, and when.
+static uint64_t busy_instret[spin_slots];
+
+typedef struct {
+    long tick;
+    uint32_t switches;
+    uint32_t button;
+} script_line;
+
+static script_line script[max_script_lines];
+static int script_length = 0;
+static int script_position = 0;
+
+/* One function from main.elf.txt. */
+typedef struct {
+    char name[64];
+    uint32_t address;
+    uint64_t calls;
+    uint64_t instructions;                      // Including the functions that it calls.
+    uint64_t stores;
+    uint64_t self_instructions;                 // Excluding them.
+    int active;                                 // Number of times it is on the shadow call stack.
+} function;
+
+static function *functions = NULL;
+static int function_count = 0;
+static uint32_t text_start = 0, text_end = 0;
+static char text_sections[8][32];               // Names of the executable sections.
+static int text_section_count = 0;
+static int *owner = NULL;                       // The function that each instruction word of the text belongs to, -1 if none.
+
+/* The shadow call stack, for counting what each function does including the functions that it calls. */
+typedef struct {
+    uint32_t return_address;
+    int function;
+    int trap;                                   // 1 if it was entered by an interrupt or an exception.
+} frame;
+
+static frame stack[max_depth];
+static int depth = 0;
+static int active[max_depth];                   // The distinct functions on the stack.
+static int active_count = 0;
+
+static void fail(const char *message, uint32_t value) {
+    fprintf(stderr, "iss: %s 0x%08x at pc 0x%08x after %llu instructions\n", message, value, pc, (unsigned long long)instret);
+    exit(2);
+}
+
+static int function_at(uint32_t address) {
+    if (address < text_start || address >= text_end) return -1;
+    return owner[(address - text_start) / 4];
+}
+
+static void push(uint32_t return_address, int f, int trap) {
+    if (depth == max_depth) {                   // Forget the outermost frame rather than stop counting.
+        int oldest = stack[0].function;
+        if (oldest >= 0 && --functions[oldest].active == 0) {
+            for (int i = 0; i < active_count; i++) if (active[i] == oldest) active[i] = active[--active_count];
+        }
+        memmove(stack, stack + 1, (max_depth - 1) * sizeof(frame));
+        depth--;
+    }
+    stack[depth].return_address = return_address;
+    stack[depth].function = f;
+    stack[depth].trap = trap;
+    depth++;
+    if (f >= 0) {
+        functions[f].calls++;
+        if (functions[f].active++ == 0) active[active_count++] = f;
+    }
+}
+
+static void pop(void) {
+    int f = stack[--depth].function;
+    if (f >= 0 && --functions[f].active == 0) {
+        for (int i = 0; i < active_count; i++) {
+            if (active[i] == f) {
+                active[i] = active[--active_count];
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Puts a function that the program got into without a call on the shadow call stack: a tail call with j or jr, or running past the end of the function before it.
+ * It takes over the frame of the function on the top of the stack, since it returns to where that one would have.
+ */
+static void replace_top(int f) {
+    if (depth == 0) {
+        push(0, f, 0);                          // The entry point.
+        return;
+    }
+    frame top = stack[depth - 1];
+    pop();
+    push(top.return_address, f, top.trap);
+}
+
+/**
+ * Applies the scripted input of the current tick. Changes are captured by the edge-capture registers like on the board.
+ */
+static void apply_script(void) {
+    while (script_position < script_length && script[script_position].tick <= ticks) {
+        switch_edges |= switches ^ script[script_position].switches;
+        button_edges |= button ^ script[script_position].button;
+        switches = script[script_position].switches;
+        button = script[script_position].button;
+        script_position++;
+    }
+}
+
+static void finish(void);
+
+/**
+ * Handles the timer timeouts and vertical syncs that have happened by the current cycle.
+ */
+static void run_events(void) {
+    while (cycles >= next_timeout || cycles >= next_vsync) {
+        if (next_timeout <= next_vsync) {
+            timer_status |= 1;
+            next_timeout = (timer_control & 2) ? next_timeout + (uint64_t)timer_period + 1 : UINT64_MAX;
+            if (!(timer_control & 2)) timer_status &= ~2u;
+            if (++ticks > tick_limit) finish();
+            apply_script();
+        } else {
+            if (vga_swap_pending) {
+                vga_buffer = vga_back_buffer;
+                vga_swap_pending = 0;
+            }
+            next_vsync += vsync_period;
+        }
+    }
+}
+
+/**
+ * Lets time pass until the next timer timeout or vertical sync.
+ */
+static void skip_to_next_event(void) {
+    uint64_t next = next_timeout < next_vsync ? next_timeout : next_vsync;
+    if (next > cycles) cycles = next;
+    run_events();
+}
+
+/**
+ * Called when a status register reads as busy or an input is read. Skips ahead if the same instruction read it a moment ago, since the program is then waiting in a loop.
+ */
+static void busy_read(void) {
+    int slot = (pc >> 2) % spin_slots;
+    if (busy_pc[slot] == pc && instret - busy_instret[slot] < spin_window) skip_to_next_event();
+    busy_pc[slot] = pc;
+    busy_instret[slot] = instret;
+}
+
+static uint32_t pending_interrupts(void) {
+    uint32_t pending = 0;
+    if ((timer_status & 1) && (timer_control & 1)) pending |= 1u << irq_timer;
+    if (switch_edges & switch_mask) pending |= 1u << irq_switches;
+    if (button_edges & button_mask) pending |= 1u << irq_button;
+    return pending;
+}
+
+static uint32_t io_load(uint32_t address) {
+    uint32_t offset = address - io_base;
+    switch (offset & ~3u) {
+    case 0x10:
+        busy_read();
+        return switches;
+    case 0x18: return switch_mask;
+    case 0x1c: return switch_edges;
+    case 0xd0:
+        busy_read();
+        return button;
+    case 0xd8: return button_mask;
+    case 0xdc: return button_edges;
+    case 0x20:
+        if (!(timer_status & 1)) busy_read();
+        return timer_status;
+    case 0x24: return timer_control;
+    case 0x28: return timer_period & 0xffff;
+    case 0x2c: return timer_period >> 16;
+    case 0x44: return 64u << 16;                // The UART always has space.
+    case 0x100: return vga_buffer;
+    case 0x104: return vga_back_buffer;
+    case 0x108: return (240u << 16) | 320u;
+    case 0x10c:
+        if (vga_swap_pending) busy_read();
+        return vga_swap_pending;
+    default: return 0;
+    }
+}
+
+static void io_store(uint32_t address, uint32_t value) {
+    uint32_t offset = address - io_base;
+    switch (offset & ~3u) {
+    case 0x18: switch_mask = value; break;
+    case 0x1c: switch_edges = 0; break;         // Writing the edge-capture register clears it.
+    case 0xd8: button_mask = value; break;
+    case 0xdc: button_edges = 0; break;
+    case 0x20: timer_status &= ~1u; break;      // Writing the status register clears TO.
+    case 0x24:
+        timer_control = value & 3;
+        if ((value & 4) && !(timer_status & 2)) {   // START
+            timer_status |= 2;
+            next_timeout = cycles + (uint64_t)timer_period + 1;
+        }
+        if (value & 8) {                        // STOP
+            timer_status &= ~2u;
+            next_timeout = UINT64_MAX;
+        }
+        break;
+    case 0x28: timer_period = (timer_period & 0xffff0000u) | (value & 0xffff); break;
+    case 0x2c: timer_period = (timer_period & 0xffff) | (value << 16); break;
+    case 0x40: if (show_uart) putchar((int)(value & 0xff)); break;
+    case 0x100: vga_swap_pending = 1; break;    // Any write requests a swap at the next vertical sync.
+    case 0x104: vga_back_buffer = value; break;
+    default: break;                             // The 7-segment displays and the rest are write-only or ignored.
+    }
+}
+
+/**
+ * Returns a pointer to the memory at the address, or NULL if it is a device register.
+ */
+static uint8_t *memory(uint32_t address, uint32_t size) {
+    if (address + size <= ram_size && address + size >= address) return ram + address;
+    if (address >= vga_base && address - vga_base + size <= vga_size) return vga + (address - vga_base);
+    if (address >= io_base && address - io_base < io_size) return NULL;
+    fail("access to unmapped address", address);
+    return NULL;
+}
+
+static uint32_t load(uint32_t address, uint32_t size) {
+    uint8_t *p = memory(address, size);
+    if (!p) return io_load(address);
+    uint32_t value = 0;
+    memcpy(&value, p, size);
+    return value;
+}
+
+static void store(uint32_t address, uint32_t value, uint32_t size) {
+    stores++;
+    for (int i = 0; i < active_count; i++) functions[active[i]].stores++;
+    uint8_t *p = memory(address, size);
+    if (!p) {
+        io_store(address, value);
+        return;
+    }
+    memcpy(p, &value, size);
+}
+
+static uint32_t read_csr(uint32_t csr) {
+    switch (csr) {
+    case 0x300: return mstatus;
+    case 0x304: return mie;
+    case 0x305: return mtvec;
+    case 0x340: return mscratch;
+    case 0x341: return mepc;
+    case 0x342: return mcause;
+    case 0x343: return mtval;
+    case 0x344: return pending_interrupts();
+    case 0xb00: case 0xc00: return (uint32_t)cycles;
+    case 0xb80: case 0xc80: return (uint32_t)(cycles >> 32);
+    case 0xb02: case 0xc02: return (uint32_t)instret;
+    case 0xb82: case 0xc82: return (uint32_t)(instret >> 32);
+    case 0xf14: return 0;                       // mhartid
+    default: return 0;
+    }
+}
+
+static void write_csr(uint32_t csr, uint32_t value) {
+    switch (csr) {
+    case 0x300: mstatus = value & 0x88; break;  // Only MIE and MPIE are kept.
+    case 0x304: mie = value; break;
+    case 0x305: mtvec = value; break;
+    case 0x340: mscratch = value; break;
+    case 0x341: mepc = value & ~3u; break;
+    case 0x342: mcause = value; break;
+    case 0x343: mtval = value; break;
+    default: break;
+    }
+}
+
+/**
+ * Enters the trap handler at mtvec, like the processor does for an interrupt or an exception.
+ */
+static void trap(uint32_t cause, uint32_t return_pc) {
+    int interrupt = (cause & 0x80000000u) != 0;
+    mepc = return_pc;
+    mcause = cause;
+    mstatus = (mstatus & ~0x88u) | ((mstatus & 8) << 4);    // MPIE = MIE, MIE = 0.
+    pc = (mtvec & ~3u) + ((interrupt && (mtvec & 1)) ? 4 * (cause & 0x7fffffff) : 0);
+    push(return_pc, function_at(pc), 1);
+}
+
+static inline int32_t imm_i(uint32_t i) { return (int32_t)i >> 20; }
+static inline int32_t imm_s(uint32_t i) { return ((int32_t)(i & 0xfe000000) >> 20) | ((i >> 7) & 0x1f); }
+static inline int32_t imm_b(uint32_t i) {
+    return ((int32_t)(i & 0x80000000) >> 19) | ((i & 0x80) << 4) | ((i >> 20) & 0x7e0) | ((i >> 7) & 0x1e);
+}
+static inline int32_t imm_j(uint32_t i) {
+    return ((int32_t)(i & 0x80000000) >> 11) | (i & 0xff000) | ((i >> 9) & 0x800) | ((i >> 20) & 0x7fe);
+}
+
+/**
+ * Executes one instruction.
+ */
+static void step(void) {
+    if (pc & 3) fail("misaligned instruction address", pc);
+    uint32_t i = load(pc, 4);
+    uint32_t rd = (i >> 7) & 31, rs1 = (i >> 15) & 31, rs2 = (i >> 20) & 31, funct3 = (i >> 12) & 7, funct7 = i >> 25;
+    uint32_t a = x[rs1], b = x[rs2];
+    uint32_t next = pc + 4;
+    uint32_t result = 0;
+    int writes = 1;
+
+    instret++;
+    cycles++;
+    int self = function_at(pc);
+    if (self >= 0 && functions[self].active == 0) replace_top(self);   // So that what a function does itself is always part of what it does including its calls.
+    if (self >= 0) functions[self].self_instructions++;
+    for (int k = 0; k < active_count; k++) functions[active[k]].instructions++;
+
+    switch (i & 0x7f) {
+    case 0x37: result = i & 0xfffff000; break;                          // lui
+    case 0x17: result = pc + (i & 0xfffff000); break;                   // auipc
+    case 0x6f:                                                          // jal
+        result = next;
+        next = pc + imm_j(i);
+        if (rd == 1 || rd == 5) push(result, function_at(next), 0);
+        break;
+    case 0x67:                                                          // jalr
+        result = next;
+        next = (a + imm_i(i)) & ~1u;
+        if (rd == 1 || rd == 5) push(result, function_at(next), 0);
+        else if (depth > 0 && !stack[depth - 1].trap && next == stack[depth - 1].return_address) pop();
+        break;
+    case 0x63: {                                                        // Branches
+        int taken;
+        switch (funct3) {
+        case 0: taken = a == b; break;
+        case 1: taken = a != b; break;
+        case 4: taken = (int32_t)a < (int32_t)b; break;
+        case 5: taken = (int32_t)a >= (int32_t)b; break;
+        case 6: taken = a < b; break;
+        case 7: taken = a >= b; break;
+        default: fail("illegal instruction", i); return;
+        }
+        if (taken) next = pc + imm_b(i);
+        writes = 0;
+        break;
+    }
+    case 0x03: {                                                        // Loads
+        uint32_t address = a + imm_i(i);
+        switch (funct3) {
+        case 0: result = (uint32_t)(int32_t)(int8_t)load(address, 1); break;
+        case 1: result = (uint32_t)(int32_t)(int16_t)load(address, 2); break;
+        case 2: result = load(address, 4); break;
+        case 4: result = load(address, 1); break;
+        case 5: result = load(address, 2); break;
+        default: fail("illegal instruction", i);
+        }
+        break;
+    }
+    case 0x23: {                                                        // Stores
+        uint32_t address = a + imm_s(i);
+        if (funct3 > 2) fail("illegal instruction", i);
+        store(address, b, 1u << funct3);
+        writes = 0;
+        break;
+    }
+    case 0x13: {                                                        // Operations with an immediate
+        int32_t imm = imm_i(i);
+        uint32_t shamt = rs2;
+        switch (funct3) {
+        case 0: result = a + imm; break;
+        case 1: result = a << shamt; break;
+        case 2: result = (int32_t)a < imm; break;
+        case 3: result = a < (uint32_t)imm; break;
+        case 4: result = a ^ imm; break;
+        case 5: result = (funct7 & 0x20) ? (uint32_t)((int32_t)a >> shamt) : a >> shamt; break;
+        case 6: result = a | imm; break;
+        case 7: result = a & imm; break;
+        }
+        break;
+    }
+    case 0x33:                                                          // Operations on registers
+        if (funct7 == 1) {                                              // The M extension
+            switch (funct3) {
+            case 0: result = a * b; break;
+            case 1: result = (uint32_t)(((int64_t)(int32_t)a * (int32_t)b) >> 32); break;
+            case 2: result = (uint32_t)(((int64_t)(int32_t)a * (uint64_t)b) >> 32); break;
+            case 3: result = (uint32_t)(((uint64_t)a * b) >> 32); break;
+            case 4: result = b == 0 ? 0xffffffff : (a == 0x80000000 && b == 0xffffffff) ? a : (uint32_t)((int32_t)a / (int32_t)b); break;
+            case 5: result = b == 0 ? 0xffffffff : a / b; break;
+            case 6: result = b == 0 ? a : (a == 0x80000000 && b == 0xffffffff) ? 0 : (uint32_t)((int32_t)a % (int32_t)b); break;
+            case 7: result = b == 0 ? a : a % b; break;
+            }
+        } else {
+            switch (funct3) {
+            case 0: result = (funct7 & 0x20) ? a - b : a + b; break;
+            case 1: result = a << (b & 31); break;
+            case 2: result = (int32_t)a < (int32_t)b; break;
+            case 3: result = a < b; break;
+            case 4: result = a ^ b; break;
+            case 5: result = (funct7 & 0x20) ? (uint32_t)((int32_t)a >> (b & 31)) : a >> (b & 31); break;
+            case 6: result = a | b; break;
+            case 7: result = a & b; break;
+            }
+        }
+        break;
+    case 0x0f: writes = 0; break;                                       // fence
+    case 0x73:                                                          // System instructions
+        if (funct3 == 0) {
+            writes = 0;
+            if (i == 0x00000073) {                                      // ecall
+                trap(11, pc);
+                return;
+            } else if (i == 0x30200073) {                               // mret
+                mstatus = (mstatus & ~0x88u) | ((mstatus >> 4) & 8) | 0x80;
+                next = mepc;
+                while (depth > 0 && !stack[depth - 1].trap) pop();
+                if (depth > 0) pop();
+            } else if (i == 0x10500073) {                               // wfi
+                while (!(pending_interrupts() & mie)) {
+                    if (next_timeout == UINT64_MAX && !(switch_mask | button_mask)) fail("wfi with nothing that can wake it up", i);
+                    skip_to_next_event();
+                }
+            } else if (i == 0x00100073) {                               // ebreak
+                fail("ebreak", i);
+            } else {
+                fail("illegal instruction", i);
+            }
+        } else {
+            uint32_t csr = i >> 20;
+            uint32_t operand = (funct3 & 4) ? rs1 : a;
+            result = read_csr(csr);
+            switch (funct3 & 3) {
+            case 1: write_csr(csr, operand); break;
+            case 2: if (rs1) write_csr(csr, result | operand); break;
+            case 3: if (rs1) write_csr(csr, result & ~operand); break;
+            default: fail("illegal instruction", i);
+            }
+        }
+        break;
+    default:
+        fail("illegal instruction", i);
+    }
+
+    if (writes && rd) x[rd] = result;
+    pc = next;
+
+    run_events();
+    uint32_t pending = pending_interrupts() & mie;
+    if ((mstatus & 8) && pending) {
+        uint32_t cause = irq_timer;
+        while (!(pending & (1u << cause))) cause = (cause + 1) & 31;
+        trap(0x80000000u | cause, pc);
+    }
+}
+
+/**
+ * Loads the segments of the ELF file into memory and finds the range of the executable sections.
+ */
+static void load_elf(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        exit(2);
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = malloc(size);
+    if (!data || fread(data, 1, size, file) != (size_t)size) {
+        fprintf(stderr, "iss: can't read %s\n", path);
+        exit(2);
+    }
+    fclose(file);
+
+    Elf32_Ehdr *header = (Elf32_Ehdr *)data;
+    if (size < (long)sizeof *header || memcmp(header->e_ident, ELFMAG, SELFMAG) != 0 || header->e_ident[EI_CLASS] != ELFCLASS32 || header->e_machine != EM_RISCV) {
+        fprintf(stderr, "iss: %s is not a 32-bit RISC-V ELF file\n", path);
+        exit(2);
+    }
+    for (int n = 0; n < header->e_phnum; n++) {
+        Elf32_Phdr *segment = (Elf32_Phdr *)(data + header->e_phoff + n * header->e_phentsize);
+        if (segment->p_type != PT_LOAD) continue;
+        if (segment->p_paddr + segment->p_memsz > ram_size) {
+            fprintf(stderr, "iss: a segment of %s doesn't fit in memory\n", path);
+            exit(2);
+        }
+        memcpy(ram + segment->p_paddr, data + segment->p_offset, segment->p_filesz);
+    }
+    text_start = UINT32_MAX;
+    for (int n = 0; n < header->e_shnum; n++) {
+        Elf32_Shdr *section = (Elf32_Shdr *)(data + header->e_shoff + n * header->e_shentsize);
+        if (!(section->sh_flags & SHF_EXECINSTR)) continue;
+        if (text_section_count < 8 && header->e_shstrndx != SHN_UNDEF) {
+            Elf32_Shdr *names = (Elf32_Shdr *)(data + header->e_shoff + header->e_shstrndx * header->e_shentsize);
+            snprintf(text_sections[text_section_count++], 32, "%s", (char *)data + names->sh_offset + section->sh_name);
+        }
+        if (section->sh_addr < text_start) text_start = section->sh_addr;
+        if (section->sh_addr + section->sh_size > text_end) text_end = section->sh_addr + section->sh_size;
+    }
+    if (text_start > text_end) text_start = text_end = 0;
+    pc = header->e_entry;
+    free(data);
+}
+
+static int by_address(const void *a, const void *b) {
+    uint32_t x = ((const function *)a)->address, y = ((const function *)b)->address;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * Reads the symbols of the executable sections from the objdump output, lines like "00000148 <_start>:".
+ * A name that is used more than once, like a local label of the floating-point library, gets the suffix ".2", ".3" and so on.
+ */
+static void load_symbols(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        exit(2);
+    }
+    char line[512];
+    int capacity = 0;
+    int in_text = 0;
+    while (fgets(line, sizeof line, file)) {
+        unsigned int address;
+        char name[64];
+        if (sscanf(line, "Disassembly of section %63[^:]:", name) == 1) {
+            in_text = 0;
+            for (int n = 0; n < text_section_count; n++) in_text |= strcmp(name, text_sections[n]) == 0;
+            continue;
+        }
+        if (!in_text || sscanf(line, "%x <%54[^>]>:", &address, name) != 2) continue;
+        if (address < text_start || address >= text_end) continue;
+        int uses = 1;
+        for (int f = 0; f < function_count; f++) uses += strncmp(functions[f].name, name, strlen(name)) == 0 &&
+            (functions[f].name[strlen(name)] == 0 || functions[f].name[strlen(name)] == '.');
+        if (uses > 1) snprintf(name + strlen(name), sizeof name - strlen(name), ".%d", uses);
+        if (function_count == capacity) {
+            capacity = capacity ? 2 * capacity : 256;
+            functions = realloc(functions, capacity * sizeof(function));
+        }
+        memset(&functions[function_count], 0, sizeof(function));
+        strcpy(functions[function_count].name, name);
+        functions[function_count].address = address;
+        function_count++;
+    }
+    fclose(file);
+    qsort(functions, function_count, sizeof(function), by_address);
+
+    owner = malloc(((text_end - text_start) / 4 + 1) * sizeof(int));
+    int f = -1;
+    for (uint32_t address = text_start; address < text_end; address += 4) {
+        while (f + 1 < function_count && functions[f + 1].address <= address) f++;
+        owner[(address - text_start) / 4] = f;
+    }
+}
+
+static void load_script(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        exit(2);
+    }
+    char line[256];
+    while (script_length < max_script_lines && fgets(line, sizeof line, file)) {
+        script_line *entry = &script[script_length];
+        char *end;
+        entry->tick = strtol(line, &end, 0);
+        if (end == line) continue;                  // Skip empty lines and comments.
+        entry->switches = (uint32_t)strtol(end, &end, 0);
+        entry->button = (uint32_t)strtol(end, &end, 0);
+        script_length++;
+    }
+    fclose(file);
+}
+
+static const char *baseline_path = NULL;
+static const char *new_baseline_path = NULL;
+static double threshold = 2.0;
+
+static int by_instructions(const void *a, const void *b) {
+    uint64_t x = ((const function *)a)->instructions, y = ((const function *)b)->instructions;
+    return x > y ? -1 : x < y;
+}
+
+/**
+ * Compares a count with its baseline. Returns 1 if it grew by more than the threshold.
+ */
+static int regressed(const char *name, const char *what, uint64_t count, uint64_t base) {
+    double change = base ? 100.0 * ((double)count - (double)base) / (double)base : (count ? 100.0 : 0.0);
+    if (change > threshold) {
+        printf("REGRESSION %-28s %-12s %12llu -> %12llu (%+.1f%%)\n", name, what, (unsigned long long)base, (unsigned long long)count, change);
+        return 1;
+    }
+    if (change < -threshold) printf("improvement %-27s %-12s %12llu -> %12llu (%+.1f%%)\n", name, what, (unsigned long long)base, (unsigned long long)count, change);
+    return 0;
+}
+
+/**
+ * Prints the counts of every function that ran, and compares them with the baseline or writes a new one. Ends the run.
+ */
+static void finish(void) {
+    fflush(stdout);
+    ticks = tick_limit;
+    qsort(functions, function_count, sizeof(function), by_instructions);
+
+    printf("%-32s %10s %14s %12s %14s\n", "function", "calls", "instructions", "stores", "self ins");
+    for (int f = 0; f < function_count; f++) {
+        const function *fn = &functions[f];
+        if (fn->instructions == 0 && fn->self_instructions == 0) continue;
+        printf("%-32s %10llu %14llu %12llu %14llu\n", fn->name, (unsigned long long)fn->calls, (unsigned long long)fn->instructions,
+            (unsigned long long)fn->stores, (unsigned long long)fn->self_instructions);
+    }
+    printf("%-32s %10s %14llu %12llu\n", "total", "", (unsigned long long)instret, (unsigned long long)stores);
+    printf("%ld ticks, %llu cycles, %.1f instructions per tick\n", tick_limit, (unsigned long long)cycles, (double)instret / tick_limit);
+
+    int inconsistent = 0;                       // The shadow call stack lost track of a function, so its counts can't be trusted.
+    for (int f = 0; f < function_count; f++) {
+        if (functions[f].self_instructions <= functions[f].instructions) continue;
+        printf("INCONSISTENT %-26s %llu instructions by itself, %llu including its calls\n", functions[f].name,
+            (unsigned long long)functions[f].self_instructions, (unsigned long long)functions[f].instructions);
+        inconsistent = 1;
+    }
+    if (inconsistent) exit(2);
+
+    if (new_baseline_path) {
+        FILE *file = fopen(new_baseline_path, "w");
+        if (!file) {
+            perror(new_baseline_path);
+            exit(2);
+        }
+        fprintf(file, "# function instructions stores, for %ld ticks\n", tick_limit);
+        fprintf(file, "total %llu %llu\n", (unsigned long long)instret, (unsigned long long)stores);
+        for (int f = 0; f < function_count; f++) {
+            if (functions[f].instructions) fprintf(file, "%s %llu %llu\n", functions[f].name, (unsigned long long)functions[f].instructions, (unsigned long long)functions[f].stores);
+        }
+        fclose(file);
+        printf("wrote %s\n", new_baseline_path);
+    }
+
+    int failed = 0;
+    if (baseline_path) {
+        FILE *file = fopen(baseline_path, "r");
+        if (!file) {
+            perror(baseline_path);
+            exit(2);
+        }
+        char line[256];
+        while (fgets(line, sizeof line, file)) {
+            char name[64];
+            unsigned long long base_instructions, base_stores;
+            if (line[0] == '#' || sscanf(line, "%63s %llu %llu", name, &base_instructions, &base_stores) != 3) continue;
+
+            uint64_t count_instructions = 0, count_stores = 0;
+            int found = 0;
+            if (strcmp(name, "total") == 0) {
+                count_instructions = instret;
+                count_stores = stores;
+                found = 1;
+            }
+            for (int f = 0; f < function_count && !found; f++) {
+                if (strcmp(functions[f].name, name) != 0) continue;
+                count_instructions = functions[f].instructions;
+                count_stores = functions[f].stores;
+                found = 1;
+            }
+            if (!found) {
+                printf("gone       %s\n", name);
+                continue;
+            }
+            failed |= regressed(name, "instructions", count_instructions, base_instructions);
+            failed |= regressed(name, "stores", count_stores, base_stores);
+        }
+        fclose(file);
+        printf(failed ? "FAILED: more than %.1f%% over %s\n" : "OK: within %.1f%% of %s\n", threshold, baseline_path);
+    }
+    exit(failed);
+}
+
+int main(int argc, char **argv) {
+    int option;
+    while ((option = getopt(argc, argv, "t:i:b:r:w:u")) != -1) {
+        switch (option) {
+        case 't': tick_limit = strtol(optarg, NULL, 0); break;
+        case 'i': load_script(optarg); break;
+        case 'b': baseline_path = optarg; break;
+        case 'r': threshold = strtod(optarg, NULL); break;
+        case 'w': new_baseline_path = optarg; break;
+        case 'u': show_uart = 1; break;
+        default:
+            fprintf(stderr, "usage: iss [-t ticks] [-i input] [-b baseline] [-r percent] [-w baseline] [-u] main.elf main.elf.txt\n");
+            return 2;
+        }
+    }
+    if (argc - optind != 2) {
+        fprintf(stderr, "usage: iss [-t ticks] [-i input] [-b baseline] [-r percent] [-w baseline] [-u] main.elf main.elf.txt\n");
+        return 2;
+    }
+    if (tick_limit <= 0) tick_limit = 1;
+
+    ram = calloc(ram_size, 1);
+    vga = calloc(vga_size, 1);
+    if (!ram || !vga) {
+        fprintf(stderr, "iss: out of memory\n");
+        return 2;
+    }
+    load_elf(argv[optind]);
+    load_symbols(argv[optind + 1]);
+    apply_script();
+
+    while (1) step();
+}
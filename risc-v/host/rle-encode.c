@@ -0,0 +1,134 @@
+/*
+    rle-encode.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Converts binary PPM images (P6) into run-length encoded RGB332 images for image.c, written as C source to standard output.
+Each image is named after its file, so assets/title.ppm becomes title_image.
+Usage: rle-encode image.ppm...
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Reads the next number from the header of a PPM file, skipping whitespace and comments.
+ */
+static int read_header_number(FILE *file) {
+    int c = fgetc(file);
+    while (c == '#' || isspace(c)) {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) c = fgetc(file);
+        }
+        c = fgetc(file);
+    }
+
+    int value = 0;
+    while (isdigit(c)) {
+        value = value * 10 + (c - '0');
+        c = fgetc(file);
+    }
+    return value;                       // The single whitespace character after the number has been consumed.
+}
+
+/**
+ * Converts a 24-bit color to the RGB332 format of the VGA output.
+ */
+static uint8_t to_rgb332(int red, int green, int blue) {
+    return (red & 0xe0) | ((green & 0xe0) >> 3) | (blue >> 6);
+}
+
+/**
+ * Writes the name of the image, which is the file name without its directories and extension.
+ */
+static void image_name(const char *path, char *name, size_t size) {
+    const char *start = strrchr(path, '/');
+    start = start ? start + 1 : path;
+
+    size_t length = strcspn(start, ".");
+    if (length >= size) length = size - 1;
+    for (size_t i = 0; i < length; i++) name[i] = isalnum((unsigned char)start[i]) ? start[i] : '_';
+    name[length] = '\0';
+}
+
+/**
+ * Encodes one image. Returns 0 on success.
+ */
+static int encode(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        return 1;
+    }
+
+    if (fgetc(file) != 'P' || fgetc(file) != '6') {
+        fprintf(stderr, "%s: not a binary PPM (P6) image\n", path);
+        fclose(file);
+        return 1;
+    }
+    int width = read_header_number(file);
+    int height = read_header_number(file);
+    int max_value = read_header_number(file);
+    if (width <= 0 || height <= 0 || max_value != 255) {
+        fprintf(stderr, "%s: only 8-bit PPM images are supported\n", path);
+        fclose(file);
+        return 1;
+    }
+
+    char name[64];
+    image_name(path, name, sizeof name);
+    printf("static const uint32_t %s_runs[] = {", name);
+
+    long pixels = (long)width * height;
+    long run_count = 0;
+    long length = 0;
+    int color = -1;
+    for (long i = 0; i <= pixels; i++) {
+        int next = -1;                  // -1 after the last pixel, which ends the last run.
+        if (i < pixels) {
+            int red = fgetc(file);
+            int green = fgetc(file);
+            int blue = fgetc(file);
+            if (blue == EOF) {
+                fprintf(stderr, "%s: the image ends early\n", path);
+                fclose(file);
+                return 1;
+            }
+            next = to_rgb332(red, green, blue);
+        }
+
+        if (next == color) {
+            length++;
+            continue;
+        }
+        if (length > 0) {
+            printf("%s0x%08lx,", run_count % 8 ? " " : "\n    ", (unsigned long)(length << 8 | color));
+            run_count++;
+        }
+        color = next;
+        length = 1;
+    }
+    fclose(file);
+
+    printf("\n};\n\n");
+    printf("const image %s_image = { %d, %d, %ld, %s_runs };\n", name, width, height, run_count, name);
+    fprintf(stderr, "%s: %ld pixels in %ld runs\n", path, pixels, run_count);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    printf("/*\n    assets.c\n    Generated by host/rle-encode from the images in assets/. Do not edit.\n*/\n\n");
+    printf("#include <stdint.h>\n#include \"assets.h\"\n");
+
+    for (int i = 1; i < argc; i++) {
+        printf("\n");
+        if (encode(argv[i]) != 0) return 1;
+    }
+    return 0;
+}
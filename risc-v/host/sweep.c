@@ -0,0 +1,263 @@
+/*
+    sweep.c
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+/*
+Headless batch simulator for tuning the game modes. Plays computer-against-computer games with the physics of pong.c and ai.c,
+for every combination of the ball velocity, the paddle velocity and a game mode, and reports per combination how long the rallies are,
+how the games end and whether a ball ever went through a paddle. Nothing is drawn and no device is read.
+The games run in one worker process per core, so that every worker has its own copy of the game state. The workers take small batches
+of games from a shared counter until none are left, so a worker that gets short games simply takes more of them.
+Each game has its own seed for the random errors of the computer players, so the report doesn't depend on the number of workers.
+Built with TUNABLE, see tuning.h.
+Usage: sweep [games per combination] [workers]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../ai.h"
+#include "../geometry.h"
+#include "../input.h"
+#include "../pong.h"
+#include "../tuning.h"
+
+#define batch_games 8                           // Games that a worker takes from the shared counter at a time.
+#define rally_limit (120 * PHYSICS_HZ)          // A rally that lasts longer than two minutes ends the game unfinished.
+#define cache_line 64
+
+/* One game mode that the sweep tries with every combination of velocities. */
+typedef struct {
+    const char *name;
+    int switches;                               // The switches of the game mode.
+    int fast_ball_acceleration;
+    int precision_paddle_height;
+} sweep_mode;
+
+static const int ball_velocities[] = { -40, DEFAULT_BALL_VELOCITY, -70, -100 };
+static const int paddle_velocities[] = { 80, DEFAULT_PADDLE_VELOCITY, 140 };
+static const sweep_mode modes[] = {
+    { "normal", 0, DEFAULT_FAST_BALL_ACCELERATION, DEFAULT_PRECISION_PADDLE_HEIGHT },
+    { "fast-ball 10", 1 << SW_FAST_BALL, 10, DEFAULT_PRECISION_PADDLE_HEIGHT },
+    { "fast-ball 20", 1 << SW_FAST_BALL, 20, DEFAULT_PRECISION_PADDLE_HEIGHT },
+    { "precision 4", 1 << SW_PRECISION_PONG, DEFAULT_FAST_BALL_ACCELERATION, 4 },
+    { "precision 8", 1 << SW_PRECISION_PONG, DEFAULT_FAST_BALL_ACCELERATION, 8 },
+};
+
+#define count_of(array) ((int)(sizeof array / sizeof array[0]))
+#define combination_count (count_of(ball_velocities) * count_of(paddle_velocities) * count_of(modes))
+
+/* The results of one batch of games. Each batch has a cache line of its own, so that workers writing their results never share one. */
+typedef struct {
+    long long rally_steps;                      // Physics steps of all rallies that ended with a point.
+    int rallies;
+    int longest_rally;                          // In physics steps.
+    int finished;                               // Games that a player won.
+    int stalled;                                // Games that ended with a rally longer than rally_limit.
+    int tunneling;                              // Times that a ball passed the face of a paddle that it should have hit.
+    int player1_wins;
+    int loser_points[WINNING_SCORE];            // How many points the loser of each finished game got.
+} __attribute__((aligned(cache_line))) tally;
+
+/* Memory that is shared between the workers. The counter has a cache line of its own, since every worker writes it. */
+typedef struct {
+    int next_batch __attribute__((aligned(cache_line)));
+    tally batches[];
+} shared_memory;
+
+/**
+ * Sets the tuning values and the game mode of combination number index.
+ */
+static void apply_combination(int index) {
+    const sweep_mode *mode = &modes[index % count_of(modes)];
+    index /= count_of(modes);
+    tuning.paddle_velocity = paddle_velocities[index % count_of(paddle_velocities)];
+    index /= count_of(paddle_velocities);
+    tuning.ball_velocity = ball_velocities[index];
+    tuning.fast_ball_acceleration = mode->fast_ball_acceleration;
+    tuning.precision_paddle_height = mode->precision_paddle_height;
+
+    input_switches = mode->switches;
+    input_changed = SW_MASK;            // Turns every game mode on or off.
+    set_special_game_modes();
+    input_changed = 0;
+}
+
+/* The balls as they were before a step, for finding the ones that go through a paddle during it. */
+static unsigned char before_alive[BALL_CAPACITY];
+static fixed before_fx[BALL_CAPACITY], before_fy[BALL_CAPACITY], before_dx[BALL_CAPACITY], before_dy[BALL_CAPACITY];
+static fixed before_paddle[2];
+
+static void remember_balls(void) {
+    int slots = ball_slots;
+    memcpy(before_alive, ball_alive, slots);
+    memcpy(before_fx, ball_fx, slots * sizeof(fixed));
+    memcpy(before_fy, ball_fy, slots * sizeof(fixed));
+    memcpy(before_dx, ball_dx, slots * sizeof(fixed));
+    memcpy(before_dy, ball_dy, slots * sizeof(fixed));
+    before_paddle[0] = paddles[0].position;
+    before_paddle[1] = paddles[1].position;
+}
+
+/**
+ * Returns the number of balls that passed the face of the paddle of player 1 or 2 during the last step although the paddle was in their way.
+ * Only balls that are still in play and moved in a straight line are checked, which is the same path that move_balls tests against the paddles.
+ */
+static int count_tunneling(int slots) {
+    fixed half_ball = int_to_fixed(ball_size/2);
+    int count = 0;
+    for (int ball = 0; ball < slots; ball++) {
+        if (!before_alive[ball] || !ball_alive[ball]) continue;
+        if ((ball_dx[ball] ^ before_dx[ball]) < 0 || (ball_dy[ball] ^ before_dy[ball]) < 0) continue;   // It bounced, the path isn't straight.
+
+        for (int player = 0; player < 2; player++) {
+            const paddle *p = &paddles[player];
+            fixed face = p->side < 0 ? int_to_fixed(p->line + PLAYER_WIDTH) + half_ball : int_to_fixed(p->line) - half_ball;
+            fixed speed = before_dx[ball] * p->side;
+            fixed distance = (face - before_fx[ball]) * p->side;
+            if (speed <= 0 || distance < 0 || (ball_fx[ball] - face) * p->side <= 0) continue;
+
+            fixed y = before_fy[ball] + fixed_mul(before_dy[ball], fixed_fraction(distance, speed));
+            fixed reach = int_to_fixed(p->size/2) + half_ball;
+            if (y - before_paddle[player] <= reach && before_paddle[player] - y <= reach) count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Plays one game between two computer players with the current tuning and adds its results to the tally.
+ */
+static void play_game(unsigned int seed, tally *t) {
+    initialize_game();
+    ai_reset(seed);
+
+    int step = 0;
+    int rally_start = 0;
+    int points = 0;
+    while (1) {
+        step++;
+        if (fast_ball && step % (2 * PHYSICS_HZ) == 0) accelerate_balls();    // The same pace as update_timer() in labmain.c.
+
+        ai_update_player(0);
+        ai_update_player(1);
+        int slots = ball_slots;
+        remember_balls();
+        move_balls();
+        move_paddles();
+        t->tunneling += count_tunneling(slots);
+
+        if (player_scores[0] + player_scores[1] != points) {
+            points = player_scores[0] + player_scores[1];
+            int length = step - rally_start;
+            rally_start = step;
+            t->rallies++;
+            t->rally_steps += length;
+            if (length > t->longest_rally) t->longest_rally = length;
+        }
+
+        int winner = player_scores[0] >= WINNING_SCORE ? 0 : player_scores[1] >= WINNING_SCORE ? 1 : -1;
+        if (winner >= 0) {
+            t->finished++;
+            t->player1_wins += winner == 0;
+            t->loser_points[player_scores[winner ^ 1]]++;
+            return;
+        }
+        if (step - rally_start > rally_limit) {
+            t->stalled++;
+            return;
+        }
+    }
+}
+
+/**
+ * Takes batches from the shared counter and plays them until there are none left.
+ */
+static void work(shared_memory *shared, int games, int batches_per_combination) {
+    while (1) {
+        int batch = __atomic_fetch_add(&shared->next_batch, 1, __ATOMIC_RELAXED);
+        if (batch >= combination_count * batches_per_combination) return;
+
+        int combination = batch / batches_per_combination;
+        int first = (batch % batches_per_combination) * batch_games;
+        int last = first + batch_games < games ? first + batch_games : games;
+        tally *t = &shared->batches[batch];
+
+        apply_combination(combination);
+        for (int game = first; game < last; game++) {
+            play_game((unsigned int)(combination * 1000003 + game) * 2654435761u + 1, t);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    int games = argc > 1 ? (int)strtol(argv[1], NULL, 0) : 200;
+    int workers = argc > 2 ? (int)strtol(argv[2], NULL, 0) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (games <= 0) games = 1;
+    if (workers <= 0) workers = 1;
+
+    int batches_per_combination = (games + batch_games - 1) / batch_games;
+    size_t size = sizeof(shared_memory) + (size_t)combination_count * batches_per_combination * sizeof(tally);
+    shared_memory *shared = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    for (int worker = 0; worker < workers; worker++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            return 1;
+        }
+        if (pid == 0) {
+            work(shared, games, batches_per_combination);
+            _exit(0);
+        }
+    }
+    int failed = 0;
+    for (int worker = 0; worker < workers; worker++) {
+        int status;
+        if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = 1;
+    }
+    if (failed) {
+        fprintf(stderr, "sweep: a worker failed\n");
+        return 1;
+    }
+
+    long long total_rallies = 0;
+    printf("%5s %6s %-13s %7s %8s %8s %8s %7s %7s %7s  %s\n",
+        "ball", "paddle", "mode", "games", "rallies", "mean s", "max s", "stalled", "tunnel", "p1 win", "loser points 0/1/...");
+    for (int combination = 0; combination < combination_count; combination++) {
+        tally sum = { 0 };
+        for (int i = 0; i < batches_per_combination; i++) {
+            const tally *t = &shared->batches[combination * batches_per_combination + i];
+            sum.rally_steps += t->rally_steps;
+            sum.rallies += t->rallies;
+            if (t->longest_rally > sum.longest_rally) sum.longest_rally = t->longest_rally;
+            sum.finished += t->finished;
+            sum.stalled += t->stalled;
+            sum.tunneling += t->tunneling;
+            sum.player1_wins += t->player1_wins;
+            for (int points = 0; points < WINNING_SCORE; points++) sum.loser_points[points] += t->loser_points[points];
+        }
+        total_rallies += sum.rallies;
+
+        apply_combination(combination);
+        printf("%5d %6d %-13s %7d %8d %8.2f %8.2f %7d %7d %6.1f%% ",
+            tuning.ball_velocity, tuning.paddle_velocity, modes[combination % count_of(modes)].name,
+            games, sum.rallies, sum.rallies ? (double)sum.rally_steps / sum.rallies / PHYSICS_HZ : 0.0,
+            (double)sum.longest_rally / PHYSICS_HZ, sum.stalled, sum.tunneling,
+            sum.finished ? 100.0 * sum.player1_wins / sum.finished : 0.0);
+        for (int points = 0; points < WINNING_SCORE; points++) printf(points ? "/%d" : " %d", sum.loser_points[points]);
+        printf("\n");
+    }
+    printf("%d combinations, %lld rallies, %d workers\n", combination_count, total_rallies, workers);
+    return 0;
+}
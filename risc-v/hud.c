@@ -0,0 +1,125 @@
+/*
+    hud.c
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "hal.h"
+#include "hud.h"
+#include "pong.h"
+
+/* Where the scores and the game time are shown. Scores above 9 need two displays each, which only leaves room for the minutes. */
+#if WINNING_SCORE < 10
+#define score_digits 1
+#define score2_display 0
+#define score1_display 1
+#define seconds_display 2
+#define minutes_display 4
+#else
+#define score_digits 2
+#define score2_display 0
+#define minutes_display 2
+#define score1_display 4
+#endif
+
+#define decimal_point_bit 0x80          // The segments are active low, so clearing this bit lights the decimal point.
+#define blank_segments 0x7f
+
+/* Segments to light for each digit, active low. Bits 0-6 are segments a-g. */
+static const unsigned char digit_segments[10] = {
+    0b1000000, 0b1111001, 0b0100100, 0b0110000, 0b0011001,
+    0b0010010, 0b0000010, 0b1111000, 0b0000000, 0b0010000,
+};
+
+static unsigned char shadow[HUD_DISPLAYS] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };   // The values that the displays should show. All segments off.
+static int written[HUD_DISPLAYS] = { -1, -1, -1, -1, -1, -1 };                      // The values that the displays show right now, -1 before the first write.
+static int dirty = 0;                                                               // One bit for each display whose shadow value differs from what was written.
+
+/**
+ * Stores a new value for a display in the shadow copy and marks it if it differs from what the display shows.
+ */
+static void set_display(int display, unsigned char value) {
+    shadow[display] = value;
+    if (value != written[display]) {
+        dirty |= 1 << display;
+    } else {
+        dirty &= ~(1 << display);
+    }
+}
+
+/**
+ * Shows a digit on a display. The decimal point of the display is left as it is.
+ * Parameter: display is 0-5, otherwise nothing happens.
+ * Parameter: digit is 0-9, or HUD_BLANK to turn the display off.
+ */
+void hud_digit(int display, int digit) {
+    if (display < 0 || display >= HUD_DISPLAYS) return;
+
+    unsigned char segments = (digit >= 0 && digit <= 9) ? digit_segments[digit] : blank_segments;
+    set_display(display, (shadow[display] & decimal_point_bit) | segments);
+}
+
+/**
+ * Turns the decimal point of a display on or off.
+ */
+void hud_decimal_point(int display, int on) {
+    if (display < 0 || display >= HUD_DISPLAYS) return;
+
+    unsigned char segments = shadow[display] & ~decimal_point_bit;
+    set_display(display, on ? segments : segments | decimal_point_bit);
+}
+
+/**
+ * Shows a number on width displays, with its ones digit on the given display and the higher digits to the left of it.
+ * Parameter: leading_zeros, if 0 the unused displays to the left are blank instead of showing zeros.
+ * Numbers that don't fit only show their lowest digits.
+ */
+void hud_number(int display, int width, int value, int leading_zeros) {
+    if (value < 0) value = 0;
+
+    for (int i = 0; i < width; i++) {
+        if (value == 0 && i > 0 && !leading_zeros) {
+            hud_digit(display + i, HUD_BLANK);
+        } else {
+            hud_digit(display + i, value % 10);
+        }
+        value /= 10;
+    }
+}
+
+/**
+ * Shows the scores of both players. Player 1 is to the left of player 2.
+ */
+void hud_scores(int score1, int score2) {
+    hud_number(score1_display, score_digits, score1, 0);
+    hud_number(score2_display, score_digits, score2, 0);
+}
+
+/**
+ * Shows the game time as minutes and seconds, with the decimal point between them. When there is no room for the seconds only the minutes are shown.
+ */
+void hud_time(int minutes, int seconds) {
+#ifdef seconds_display
+    hud_number(seconds_display, 2, seconds, 1);
+    hud_decimal_point(minutes_display, 1);
+#else
+    (void)seconds;
+#endif
+    hud_number(minutes_display, 2, minutes, 1);
+}
+
+/**
+ * Writes the displays whose values have changed since the last flush. The others aren't touched.
+ */
+void hud_flush() {
+    if (dirty == 0) return;
+
+    for (int display = 0; display < HUD_DISPLAYS; display++) {
+        if ((dirty >> display) & 1) {
+            *(DISPLAYS + 4 * display) = shadow[display];
+            written[display] = shadow[display];
+        }
+    }
+    dirty = 0;
+}
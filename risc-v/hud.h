@@ -0,0 +1,26 @@
+/*
+    hud.h
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef HUD_H
+#define HUD_H
+
+/*
+Driver for the six 7-segment displays. The values are kept in a shadow copy, see hud.c, and hud_flush() only writes the displays that have changed.
+Display 0 is the rightmost one.
+*/
+
+#define HUD_DISPLAYS 6
+#define HUD_BLANK -1                    // Digit value that turns all segments of a display off.
+
+void hud_digit(int display, int digit);
+void hud_decimal_point(int display, int on);
+void hud_number(int display, int width, int value, int leading_zeros);
+void hud_scores(int score1, int score2);
+void hud_time(int minutes, int seconds);
+void hud_flush();
+
+#endif
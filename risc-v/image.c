@@ -0,0 +1,60 @@
+/*
+    image.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "geometry.h"
+#include "image.h"
+#include "raster.h"
+
+/**
+ * Draws the image with its top left corner at the screen pixel (x, y). The whole image must be on the screen.
+ * Images are made for the field, so each of their pixels covers SCREEN_SCALE x SCREEN_SCALE screen pixels.
+ * Each run is written with fill_pixels(), so drawing costs one call per run instead of one check per pixel.
+ * Images as wide as the screen are contiguous in the framebuffer, so their runs are written straight through without splitting them into rows.
+ */
+void draw_image(int x, int y, const image *picture) {
+    volatile char *row = VGA + SCREEN_ROW(y) + x;
+
+    if (SCREEN_SCALE == 1 && picture->width == SCREEN_WIDTH) {
+        for (int i = 0; i < picture->run_count; i++) {
+            int length = picture->runs[i] >> 8;
+            fill_pixels(row, length, (char)picture->runs[i]);
+            row += length;
+        }
+        return;
+    }
+
+    int column = 0;
+    int repeat = 0;                                     // Times that the current image row has been drawn, when SCREEN_SCALE is more than 1.
+    int row_run = 0, row_offset = 0;                    // Where the current image row starts in the runs.
+    int offset = 0;                                     // Pixels of run i that have already been drawn on earlier rows.
+    for (int i = 0; i < picture->run_count; i++) {
+        int length = (picture->runs[i] >> 8) - offset;
+        char color = (char)picture->runs[i];
+        offset = 0;
+
+        while (length > 0) {                            // Split the run where it reaches the end of a row.
+            int span = picture->width - column;
+            if (span > length) span = length;
+
+            fill_pixels(row + TO_SCREEN(column), TO_SCREEN(span), color);
+            column += span;
+            length -= span;
+            if (column == picture->width) {
+                column = 0;
+                row += SCREEN_WIDTH;
+                if (++repeat < SCREEN_SCALE) {          // Draw the same image row again below.
+                    i = row_run - 1;
+                    offset = row_offset;
+                    break;
+                }
+                repeat = 0;
+                row_run = i;
+                row_offset = (picture->runs[i] >> 8) - length;
+            }
+        }
+    }
+}
@@ -0,0 +1,26 @@
+/*
+    image.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <stdint.h>
+
+/*
+Run-length encoded images in the RGB332 colors of the VGA output.
+They are made from the PPM files in assets/ by host/rle-encode when building, see assets.c.
+*/
+typedef struct {
+    int width;
+    int height;
+    int run_count;
+    const uint32_t *runs;               // Each run is (length << 8) | color, row by row from the top left pixel. Runs continue on the next row.
+} image;
+
+void draw_image(int x, int y, const image *picture);
+
+#endif
@@ -0,0 +1,77 @@
+/*
+    input.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "hal.h"
+#include "input.h"
+#include "pong.h"
+#include "replay.h"
+
+int input_switches = 0;                 // The states of the switches in the latest snapshot.
+int input_changed = 0;                  // The switches that have changed since the snapshot before it.
+int input_pressed = 0;                  // 1 during the tick that the push-button became pressed, otherwise 0.
+int input_button = 0;                   // The debounced state of the push-button.
+
+#ifndef REPLAY
+
+#define debounce_cycles (HAL_CLOCK_PER_SECOND / 1000 * BUTTON_DEBOUNCE_MS)
+
+static int button_raw = 0;              // The state that the push-button was read as in the last snapshot.
+static unsigned int button_read_at = 0; // hal_clock() when the push-button was first read as button_raw.
+static int button_settled = 1;          // 1 once the push-button has read as button_raw for BUTTON_DEBOUNCE_MS.
+
+/**
+ * Updates the debounced state of the push-button from a reading of it.
+ * A change of the push-button counts right away if it had read the same for BUTTON_DEBOUNCE_MS before it. The bouncing that follows is ignored
+ * until it has read the same for that long again, so contact bounce doesn't count as several presses.
+ * The time is measured with hal_clock(), so it doesn't matter how often the snapshots are taken. Once the push-button has settled it is
+ * remembered in button_settled, since the counter wraps around.
+ */
+static void debounce_button(int button) {
+    unsigned int now = hal_clock();
+    if (!button_settled && now - button_read_at >= debounce_cycles) {
+        button_settled = 1;
+        if (button_raw != input_button) {
+            input_button = button_raw;  // The push-button settled in the other state after bouncing.
+            input_pressed = input_button;
+        }
+    }
+
+    if (button != button_raw) {
+        if (button_settled && button != input_button) {
+            input_button = button;      // The first change after the push-button has been still counts right away.
+            input_pressed = input_button;   // Only the edge from released to pressed is a press.
+        }
+        button_raw = button;
+        button_read_at = now;
+        button_settled = 0;
+    }
+}
+
+#endif
+
+/**
+ * Reads the switches and the push-button once and updates the snapshot.
+ * Holding the push-button down counts as a single press.
+ * When built with REPLAY the next snapshot of the recorded trace is taken instead, see replay.c. It holds the debounced push-button, so it isn't debounced again.
+ */
+void input_poll() {
+    int switches;
+
+    input_pressed = 0;
+#ifdef REPLAY
+    int button;
+    replay_input(&switches, &button);
+    input_pressed = button && !input_button;
+    input_button = button;
+#else
+    switches = get_sw() & SW_MASK;
+    debounce_button(get_btn() & 1);
+#endif
+
+    input_changed = switches ^ input_switches;
+    input_switches = switches;
+}
@@ -0,0 +1,54 @@
+/*
+    input.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef INPUT_H
+#define INPUT_H
+
+/*
+The switches and the push-button are read once per tick into a snapshot, see input.c.
+The game logic only looks at the snapshot, so each device register is read once per tick no matter how many modes use it.
+*/
+
+/* Bit positions of the switches */
+#define SW_PLAYER2 0                    // Switches 1 and 2 move player 2.
+#define SW_REVERSE_PADDLES1 2
+#define SW_MEGA_BALL 3
+#define SW_PRECISION_PONG 4
+#define SW_FAST_BALL 5
+#define SW_AI 6                         // The computer controls player 2.
+#define SW_REVERSE_PADDLES2 7
+#define SW_PLAYER1 8                    // Switches 9 and 10 move player 1.
+
+/* With more than two players, switches 4 to 7 move players 3 and 4 instead of MEGA-BALL, PRECISION-PONG, FAST-BALL and the computer player. */
+#define SW_PLAYER3 3                    // Switches 4 and 5 move player 3.
+#define SW_PLAYER4 5                    // Switches 6 and 7 move player 4.
+
+#define SW_PAUSE ((3 << SW_PLAYER1) | (3 << SW_PLAYER2))   // Turning on both switches of both players pauses the game.
+#define SW_MASK 0x3ff                   // The ten switches on the board.
+
+/*
+The switches and the push-button interrupt the processor when they change, and the snapshot is then taken right away instead of at the next tick.
+REPLAY builds take the recorded snapshots between the physics steps instead, and builds with POLLED_INPUT only take snapshots at the ticks.
+*/
+#if defined(REPLAY) || defined(POLLED_INPUT)
+#define INPUT_EDGES 0
+#else
+#define INPUT_EDGES 1
+#endif
+
+#ifndef BUTTON_DEBOUNCE_MS
+#define BUTTON_DEBOUNCE_MS 10           // Milliseconds that the push-button must read the same before a change of it counts.
+#endif
+
+void input_poll();
+
+extern int input_switches;
+extern int input_changed;
+extern int input_pressed;
+extern int input_button;
+
+#endif
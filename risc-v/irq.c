@@ -0,0 +1,25 @@
+/*
+    irq.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "irq.h"
+
+/**
+ * Handler of the interrupts that nothing has registered for. Such interrupts are never enabled, so there is nothing to do.
+ */
+static void irq_ignore(unsigned cause) {
+    (void)cause;
+}
+
+/* Read by the interrupt entries in boot.S, indexed by the cause. */
+irq_handler interrupt_handlers[IRQ_COUNT] = { [0 ... IRQ_COUNT - 1] = irq_ignore };
+
+/**
+ * Makes the handler run for every interrupt with the given cause. Register the handler before enabling the interrupt with enable_interrupt.
+ */
+void irq_register(unsigned cause, irq_handler handler) {
+    if (cause < IRQ_COUNT) interrupt_handlers[cause] = handler ? handler : irq_ignore;
+}
@@ -0,0 +1,32 @@
+/*
+    irq.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/*
+Dispatch table for the interrupts. boot.S puts mtvec in vectored mode, so each device interrupt has its own entry that only saves the
+caller-saved registers and calls the handler registered here, without looking at mcause. On the host, host/hal-host.c calls the table instead.
+*/
+
+/* mcause values of the device interrupts */
+#define IRQ_TIMER 16
+#define IRQ_SWITCHES 17
+#define IRQ_BUTTON 18
+#define IRQ_COUNT 32                    // One slot for each bit of the mie register.
+
+/**
+ * An interrupt handler. Parameter: cause is the mcause value of the interrupt, without the interrupt bit.
+ * The handler must acknowledge the interrupt in the device, or it is raised again as soon as the handler returns.
+ */
+typedef void (*irq_handler)(unsigned cause);
+
+extern irq_handler interrupt_handlers[IRQ_COUNT];
+
+void irq_register(unsigned cause, irq_handler handler);
+
+#endif
@@ -7,254 +7,254 @@
 
 #include <stdint.h> 
 #include <stdlib.h>
-
-extern void enable_interrupt(void);
-
-#define screen_width 320
-#define screen_height 240
-#define player_position 8
-#define player_width 5
-#define initial_ball_velocity -5
-#define initial_ball_size 5
-#define initial_paddle_height 30
-#define player_velocity 10
-#define PI 3.14159
-
-extern void initialize_game();
-extern void rotate_ball_vector_counter_clockwise(int degrees);
-extern void move_ball();
-extern void move_paddles();
-extern int get_btn(void);
-extern void set_paddles_velocity();
-extern void set_special_game_modes();
-extern void seven_segment_display(int display, int number);
-
-/* Coordinate variables */
-extern int player1_y;
-extern int player2_y;
-extern int ball_x;
-extern int ball_y;
-
-/* Velocity variables */
-extern int player1_dy;
-extern int player2_dy;
-extern int ball_dx;
-extern int ball_dy;
-
-/* Size variables */
-extern int paddle_height;
-extern int ball_size;
-
-/* Score variables */
-extern int player1_score;          
-extern int player2_score;
-
-/* Game state variables */
-extern int game_state;
-extern int reverse_paddles1;
-extern int reverse_paddles2;
-extern int fast_ball;
-extern int seconds;
-extern int minutes;
-
-int timeoutCount = 0;
+#include "ai.h"
+#include "capture.h"
+#include "hal.h"
+#include "hud.h"
+#include "input.h"
+#include "irq.h"
+#include "latency.h"
+#include "log.h"
+#include "pong.h"
+#include "profile.h"
+#include "raster.h"
+#include "render.h"
+#include "replay.h"
+#include "sched.h"
+
+extern void enable_interrupt(unsigned int mask);
+
+int timeoutCount = 0;                   // Physics steps since the game timer was last updated.
 int two_seconds = 0;
 
-/* VGA variables */
-volatile char *VGA = (volatile char*) 0x08000000;       // Write pixels to the screen
-volatile int *VGA_CTRL = (volatile int*) 0x04000100;    // VGA control registers, used to update the screen
+/* Fixed timestep variables. The timer interrupt counts the steps that are due, and the main loop catches up with them. */
+volatile unsigned int steps_due = 0;    // Only written by the interrupt handler.
+unsigned int steps_done = 0;            // Physics steps run since start-up. Only written by the main loop.
+unsigned int steps_skipped = 0;         // Steps that were due while the game was paused or over, which are never run. Only written by the main loop.
+int shown_screen = -1;                  // The game_state whose screen has been presented, or -1 while the game itself is drawn.
 
+void game_tick();
 
-void handle_interrupt(unsigned cause) {
+/**
+ * Handles the timer interrupt. Only does the minimum and leaves the actual work to the main loop through the run-queue.
+ */
+static void timer_interrupt(unsigned cause) {
+    (void)cause;
+    *TIMER = 0;                         // Acknowledge the interrupt by resetting the timeout flag.
+    steps_due++;                        // One more physics step is due.
+    sched_post(game_tick);              // Let the main loop catch up.
 }
 
 
 /**
- * Sets all pixels on the screen to black.
+ * Updates the seconds and minutes values and sends them to the 7-segment displays.
  */
-void reset_screen(){
-    for (int i = 0; i < screen_width * screen_height; i++) {
-            VGA[i] = 0x00; //Black
-        }
+void update_timer() {    
+    two_seconds++;                      // Used to keep track of when two-seconds have passed.
+    if(fast_ball && two_seconds >= 2) { // If the special game_mode FAST-BALL is active, increase the ball speed each 2 seconds.
+        two_seconds = 0;                // Reset the five-second status.
+        accelerate_balls();
+    }
+
+    timeoutCount = 0;                   // Reset the timeout count.
+    if(seconds >= 59) {
+        minutes++;                      // Increment minutes if the seconds have reached 59.
+        seconds = 0;                    // Reset the seconds.
+    } else {
+        seconds++;                      // Else increment seconds.
+    }
+    hud_time(minutes, seconds);                 // Show the game time on the 7-segment displays. Only the digits that changed are written.
 
+    PROFILE_SECOND();                           // Print the profiling report when it's due.
+    LATENCY_SECOND();                           // Log the latency report when it's due.
 }
 
+
 /**
- * Draws the ball on the screen.
+ * Advances the game by one fixed physics step of 1/PHYSICS_HZ seconds.
  */
-void draw_ball (){
-
-    for (int y = 0; y < ball_size; y++) {
-        for (int x = 0; x < ball_size; x++) {
-            int px = ball_x - ball_size/2 + x;
-            int py = ball_y - ball_size/2 + y;
-            if (px >= 0 && px < screen_width && py >= 0 && py < screen_height) {
-                VGA[py * screen_width + px] = 0xFF; // White pixel
-            }
-        } 
+void physics_step() {
+    timeoutCount++;
+
+    if(timeoutCount == PHYSICS_HZ) update_timer(); // Increments and updates the game timer once per second.
+
+    PROFILE_STAGE(STAGE_PADDLES_VELOCITY, set_paddles_velocity());        // Sets the velocity of the paddles according to the states of the switches.
+
+    if (PLAYERS == 2 && ((input_switches >> SW_AI) & 1)) {
+        PROFILE_STAGE(STAGE_AI, ai_update());                             // The computer moves player 2 instead of the switches.
     }
-}
 
-/**
- * Draws the paddle of player 1 on the screen.
- */
-void draw_paddle1(){
-
-    for (int y = 0; y < paddle_height; y++) {
-        for (int x = 0; x < player_width; x++) {
-            int px = player_position + x;
-            int py = player1_y - paddle_height / 2 + y;
-            if (px >= 0 && px < screen_width && py >= 0 && py < screen_height) {
-                VGA[py * screen_width + px] = 0xFF; // White pixel
-            }
-        }
+    PROFILE_STAGE(STAGE_MOVE_BALLS, move_balls());                        // Moves the balls and handles collisions.
+
+    PROFILE_STAGE(STAGE_MOVE_PADDLES, move_paddles());                    // Moves the paddles according to the input of the switches.
+
+    for (int player = 0; player < PLAYERS; player++) {
+        if (player_scores[player] >= WINNING_SCORE) game_state = GAME_OVER;   // GAME OVER when any player wins.
     }
 }
 
+/* The switches whose changes show on the screen before the next physics step, since they change the size of the ball or the paddles. */
+#define visible_switches (PLAYERS == 2 ? (1 << SW_MEGA_BALL) | (1 << SW_PRECISION_PONG) : 0)
+
 /**
- * Draws the paddle of player 2 on the screen.
+ * Takes a snapshot of the input and applies the parts of it that don't wait for a physics step: the special game modes, the push-button and pausing.
+ * Returns 1 if the next frame shows what changed, and 0 if it only shows once a physics step has used it, like a change of the paddle switches, or not at all.
  */
-void draw_paddle2(){
-
-    for (int y = 0; y < paddle_height; y++) {
-        for (int x = screen_width - player_position * (float)1.5 - player_width; x < screen_width - player_position * (float)1.5; x++) { // Float of 1.5 included to make the graphics better looking. With the float, the ball bounces right at the border of the paddle.
-            int px = player_position + x;
-            int py = player2_y - paddle_height / 2 + y;
-            if (px >= 0 && px < screen_width && py >= 0 && py < screen_height) {
-                VGA[py * screen_width + px] = 0xFF; // White pixel
-            }
-        }
+static int take_input() {
+    int state = game_state;
+
+    input_poll();                       // Read the switches and the push-button.
+#ifdef RECORD
+    record_input(steps_done, input_switches, input_button);   // Log the snapshot with the number of steps it comes after, if it changed.
+#endif
+    PROFILE_STAGE(STAGE_SPECIAL_GAME_MODES, set_special_game_modes());    // Turns special game modes on or off if their switches changed.
+
+    if (input_pressed) {
+        initialize_game();              // If the push-button is pressed, reset the game.
+        render_invalidate();            // The title or game-over screen might be showing, so the next frame must clear the whole screen.
+        steps_skipped = steps_due - steps_done;   // Don't catch up with the steps that passed while the game was over.
+        shown_screen = -1;
     }
-}
 
-/**
- * Draws a diagonal line from left to right on the screen.
- */
-void draw_diagonal_line_ltr() {
-    for (int y = 100; y < screen_height -99; y++) {
-        for (int x = 50; x < screen_width; x++) {
-            int px = x;
-            int py = y;
-            if (x==y) {
-                VGA[py * screen_width + px + 35] = 0xFF; // White pixel
-            }
-        }
+    int pause = (input_switches & SW_PAUSE) == SW_PAUSE;
+    if (game_state == GAME_RUNNING && pause) {
+        game_state = GAME_PAUSED;       // Both players turned on both of their switches.
+    } else if (game_state == GAME_PAUSED && !pause) {
+        game_state = GAME_RUNNING;
+        render_invalidate();            // Remove the pause screen.
+        steps_skipped = steps_due - steps_done;   // Don't catch up with the steps that passed while the game was paused.
+        shown_screen = -1;
     }
+
+    int shown = game_state != state || (game_state == GAME_RUNNING && (input_pressed || (input_changed & visible_switches)));
+    LATENCY_TAKEN(shown ? LATENCY_NEXT_FRAME : game_state == GAME_RUNNING ? LATENCY_NEXT_STEP : LATENCY_NOT_SHOWN);   // Changes made on a screen that stays up never reach the framebuffer.
+    return shown;
 }
 
 /**
- * Draws a diagonal line from right to left on the screen.
+ * Draws the next frame of the game, or the screen of the game state if it isn't already showing, unless the VGA controller hasn't shown the previous frame yet.
  */
-void draw_diagonal_line_rtl() {
-    for (int y = screen_height-100; y > 99; y--) {
-        for (int x = screen_width - 100; x > 0; x--) {
-            int px = x;
-            int py = y;
-            if (y==screen_height-x) {   
-                VGA[py * screen_width + px + 35] = 0xFF; // White pixel
-            }
-        }
+static void draw() {
+    if (!render_ready()) return;        // The previous frame is still waiting for the vertical sync.
+
+    if (game_state == GAME_RUNNING) {
+        render_frame();                 // Erase the ball and paddles in the back buffer and draw them at their new positions.
+        LATENCY_FRAME();
+        PROFILE_STAGE(STAGE_PRESENT, present_frame());                    // Swap the finished frame onto the screen at the next vertical sync.
+        CAPTURE_FRAME();                // Send the changes of the frame over the UART, when capturing.
+    } else if (shown_screen != game_state) {
+        if (game_state == GAME_TITLE) draw_title();
+        else if (game_state == GAME_PAUSED) draw_pause();
+        else draw_game_over();          // Show who won and the final score.
+        LATENCY_FRAME();
+        present_frame();                // The screens don't change, so they are only drawn once.
+        CAPTURE_FRAME();
+        shown_screen = game_state;
     }
 }
 
+#ifdef REPLAY
+
 /**
- * Makes the whole screen green.
+ * Takes in every recorded snapshot that was taken after the physics steps that have been run, one at a time like the snapshots of the devices.
  */
-void green_screen() {
-    for (int i = 0; i < screen_width * screen_height; i++) {
-            VGA[i] = 49;
-        }
+static void take_replayed_input() {
+    while (replay_pending(steps_done)) take_input();
 }
 
+#endif
+
 /**
- * Updates the seconds and minutes values and sends them to the 7-segment displays.
+ * One iteration of the game loop, run after each timer interrupt.
+ * Runs every physics step that is due, and then draws a frame if the screen is ready for one.
+ * If the previous frame hasn't been shown yet, this frame is dropped instead of delaying the physics.
+ * When replaying, the recorded input is taken in between the steps, after the same steps as when it was recorded.
  */
-void update_timer() {    
-    two_seconds++;                      // Used to keep track of when two-seconds have passed.
-    if(fast_ball && two_seconds >= 2) { // If the special game_mode FAST-BALL is active, increase the ball speed each 2 seconds.
-        two_seconds = 0;                // Reset the five-second status.
-        if(ball_dx > 0) {
-            if(ball_dx != 0) {
-                ball_dx += 1;           // Increase the ball velocity along the x-axis.
-            }
-        } else {
-            if(ball_dx != 0) {
-                ball_dx -= 1;           // Increase the ball velocity along the x-axis.
-            }
-        }
-        if(ball_dy > 0) {
-            if(ball_dy != 0) {
-                ball_dy += 1;           // Increase the ball velocity along the y-axis.
-            }
-        } else {
-            if(ball_dy != 0) {
-                ball_dy -= 1;           // Increase the ball velocity along the x-axis.
-            }
-        }
+void game_tick() {
+    PROFILE_BEGIN(STAGE_TICK);
+
+#ifdef REPLAY
+    take_replayed_input();
+#else
+    take_input();                       // The input of this tick, unless an interrupt has already taken it in.
+#endif
+
+    while (game_state == GAME_RUNNING && steps_done + steps_skipped != steps_due) {
+        steps_done++;
+        physics_step();
+        LATENCY_STEP();                 // A change that waited for a step shows in the next frame.
+        REPLAY_HASH(steps_done, timeoutCount, two_seconds);        // Print the state of the game after the step, when recording or replaying.
+#ifdef REPLAY
+        take_replayed_input();
+#endif
     }
 
-    timeoutCount = 0;                   // Reset the timeout count.
-    if(seconds >= 59) {
-        minutes++;                      // Increment minutes if the seconds have reached 59.
-        seconds = 0;                    // Reset the seconds.
-    } else {
-        seconds++;                      // Else increment seconds.
-    }
-    seven_segment_display(2, seconds % 10);     // Send the ones digit of the seconds to the third 7-segment display.
-    seven_segment_display(3, seconds / 10);     // Send the tens digit of the seconds to the fourth 7-segment display.
-    seven_segment_display(4, minutes % 10);     // Send the ones digit of the minutes to the fifth 7-segment display.
-    seven_segment_display(5, minutes / 10);     // Send the tens digit of the minutes to the sixth 7-segment display.
-}
-
-
-int main() {
-    initialize_game();                          // Set up the global variables for the game.
-    volatile int *timeoutPointer = (volatile int*) 0x04000020; // Creates a pointer that points to the memory adress where the timer is. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the dtek-board.
+    hud_flush();                        // Write the 7-segment displays that changed during the steps.
+    draw();
+    REPLAY_FLUSH();                     // Log the recorded input changes.
 
-    while (1) {                                 // Main game loop.
-        
-        if (get_btn()) {
-            initialize_game();                  // If the push-button is pressed, reset the game. *Should we use this inefficent polling method? Maybe replace with interruption method, but only after we have made it work to avoid painstaking debugging.*
-        } 
-
-        if(game_state) {
-            
-            if((*timeoutPointer & 1) == 1) {    // Check if the timeout event flag is true. In that case, run the program.
-                timeoutCount++;
-                *timeoutPointer &= ~1;          // Reset the timeout flag.
-
-                if(timeoutCount == 10) update_timer(); // Increments and updates the game timer.
-
-                set_special_game_modes();       // Sets special game modes according to the states of the switches.
-                
-                set_paddles_velocity();         // Sets the velocity of the paddles according to the states of the switches.
-                
-                move_ball();                    // Moves the ball and handles collisions.
-
-                reset_screen();                 // Reset the screen by making every pixel on it black.
+    PROFILE_END(STAGE_TICK);
+}
 
-                move_paddles();                 // Moves the paddles according to the input of the switches.   
+#if INPUT_EDGES
 
-                draw_ball();                    // Set the pixels where the ball is to white.
+/* The switches that move the paddles. */
+#define paddle_switches ((3 << SW_PLAYER1) | (3 << SW_PLAYER2) | (PLAYERS > 2 ? 3 << SW_PLAYER3 : 0) | (PLAYERS > 3 ? 3 << SW_PLAYER4 : 0))
 
-                draw_paddle1();                 // Set the pixels where the player 1 paddle is to white.
+/**
+ * Runs when a switch or the push-button has changed between two ticks. Takes the input in right away instead of at the next tick,
+ * and draws a frame early if the change shows on the screen before the next physics step: the push-button, pausing and the modes that change sizes.
+ * A change of the paddle switches sets the velocities of the paddles from the new snapshot right away. The paddles only move at the next physics step,
+ * so no frame is drawn early for it, since it would show nothing new and could take the vertical sync from the frame that does.
+ */
+static void input_edge() {
+    int shown = take_input();
+    if (game_state == GAME_RUNNING && (input_changed & paddle_switches)) set_paddles_velocity();
+    if (shown) {
+        hud_flush();
+        draw();
+    }
+}
 
-                draw_paddle2();                 // Set the pixels where the player 2 paddle is to white.
+#endif
 
-                if (player1_score >= 5 || player2_score >= 5) {       // Conditional statement if player 1 wins.
+#if INPUT_EDGES || defined(LATENCY)
 
-                    game_state = 0;             // Set the game_state to 0. GAME OVER.
+/**
+ * Handles the interrupts of the switches and the push-button, which their edge-capture registers raise when any of them changes.
+ * Acknowledges the interrupt by clearing the captured edges, and leaves the work to the main loop through the run-queue.
+ */
+static void input_interrupt(unsigned cause) {
+    volatile int *device = cause == IRQ_SWITCHES ? SWITCHES : BUTTON;
+    device[3] = device[3];              // Writing the captured edges back clears them.
+    LATENCY_EDGE();                     // Timestamp the change when measuring the latency.
+#if INPUT_EDGES
+    sched_post(input_edge);
+#endif
+}
 
-                    green_screen();             // Make the entire screen green.
+#endif
 
-                    draw_diagonal_line_ltr();   // Draw the diagonal line from left to right as part of the cross.
+int main() {
+    initialize_game();                          // Set up the global variables for the game.
+    game_state = GAME_TITLE;                    // Show the title screen until the push-button is pressed.
+    irq_register(IRQ_TIMER, timer_interrupt);
+    enable_interrupt(1 << IRQ_TIMER);           // Let the timer interrupt the processor each time it times out.
+#if INPUT_EDGES || defined(LATENCY)
+    irq_register(IRQ_SWITCHES, input_interrupt);
+    irq_register(IRQ_BUTTON, input_interrupt);
+    SWITCHES[2] = SW_MASK;                      // Interrupt on a change of any of the switches,
+    BUTTON[2] = 1;                              // and of the push-button.
+    enable_interrupt((1 << IRQ_SWITCHES) | (1 << IRQ_BUTTON));
+#endif
+    log_start();                                // Let the UART interrupt write the log, if the build has one for it.
 
-                    draw_diagonal_line_rtl();   // Draw the diagonal line from right to left as part of the cross.
-                }
-            }
-        }
-        /* Update VGA control registers (double-buffering simulation) and updates the screen. */
-        *(VGA_CTRL + 1) = (unsigned int)(VGA);
-        *(VGA_CTRL + 0) = 0;
+    while (1) {                                 // Main game loop.
+        sched_run_pending();                    // Run the work that the interrupts have queued up.
+        CAPTURE_DRAIN();                        // Log the next part of the captured frame, when capturing.
+#ifndef LOG_UART_IRQ
+        log_drain();                            // Write as much of the log as the UART has space for, without waiting.
+#endif                                          // Otherwise only the UART interrupt drains it, since the ring buffer has a single consumer.
+        sched_idle();                           // Sleep until the next interrupt.
     }
 }
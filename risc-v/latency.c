@@ -0,0 +1,96 @@
+/*
+    latency.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "latency.h"
+
+#ifdef LATENCY
+
+#include "hal.h"
+#include "log.h"
+
+#define cycles_per_microsecond (HAL_CYCLES_PER_SECOND / 1000000)
+
+/* Where the change being measured is. Only one change is measured at a time, and the ones that come while it is are left out. */
+#define phase_idle 0                    // No change is being measured.
+#define phase_edge 1                    // A change has been timestamped by an interrupt but not yet read by input_poll().
+#define phase_stepping 2                // The game has taken the change in, and the first frame after the next physics step shows it.
+#define phase_taken 3                   // The game has taken the change in, and the next frame it draws shows it.
+
+static volatile int phase = phase_idle;
+static unsigned int edge_cycles = 0;    // The cycle count when the change happened.
+
+/* Statistics since the last report */
+static unsigned int count = 0;
+static unsigned int cycles_sum = 0;
+static unsigned int cycles_max = 0;
+static unsigned int worst_max = 0;      // The longest latency since start-up.
+static int seconds_since_report = 0;
+
+/**
+ * Timestamps a change of the switches or the push-button. Called from their interrupt handler.
+ */
+void latency_edge() {
+    if (phase != phase_idle) return;
+    edge_cycles = hal_cycles();
+    phase = phase_edge;
+}
+
+/**
+ * Called after each snapshot of the input. A change that doesn't show on the screen, because the game is waiting on the title, pause or game-over screen, isn't measured.
+ * Parameter: shown is LATENCY_NOT_SHOWN, LATENCY_NEXT_FRAME or LATENCY_NEXT_STEP, for when the change shows.
+ */
+void latency_taken(int shown) {
+    if (phase != phase_edge) return;
+    phase = shown == LATENCY_NEXT_FRAME ? phase_taken : shown == LATENCY_NEXT_STEP ? phase_stepping : phase_idle;
+}
+
+/**
+ * Called after each physics step. A change of the paddle switches shows in the first frame after it, since the step moved the paddles.
+ */
+void latency_step() {
+    if (phase == phase_stepping) phase = phase_taken;
+}
+
+/**
+ * Called when a frame or a screen has been written to the framebuffer, just before it is presented.
+ */
+void latency_frame() {
+    if (phase != phase_taken) return;
+
+    unsigned int cycles = hal_cycles() - edge_cycles;
+    phase = phase_idle;
+    count++;
+    cycles_sum += cycles;
+    if (cycles > cycles_max) cycles_max = cycles;
+    if (cycles > worst_max) worst_max = cycles;
+}
+
+/**
+ * Called once per second of game time. Logs the number of measured changes and their average and longest latency in microseconds every LATENCY_REPORT_SECONDS seconds.
+ */
+void latency_second() {
+    if (++seconds_since_report < LATENCY_REPORT_SECONDS) return;
+    seconds_since_report = 0;
+
+    log_begin();
+    log_text("latency edges ");
+    log_dec(count);
+    log_text(" avg ");
+    log_dec(count ? cycles_sum / count / cycles_per_microsecond : 0);
+    log_text(" max ");
+    log_dec(cycles_max / cycles_per_microsecond);
+    log_text(" worst ");
+    log_dec(worst_max / cycles_per_microsecond);
+    log_text(" us\n");
+    log_end();
+
+    count = 0;
+    cycles_sum = 0;
+    cycles_max = 0;
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+    latency.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+/*
+Input-to-framebuffer latency, see latency.c. The switch and push-button interrupts timestamp each change of the input with the cycle counter,
+and the time until the first frame that shows the change is reported every few seconds.
+Only compiled in when building with LATENCY defined ('make LATENCY=1'). Otherwise the macros below expand to nothing.
+*/
+
+#ifndef LATENCY_REPORT_SECONDS
+#define LATENCY_REPORT_SECONDS 5        // How often the summary is logged.
+#endif
+
+/* When a change that the game has taken in shows on the screen, given to LATENCY_TAKEN(). */
+#define LATENCY_NOT_SHOWN 0             // Never, since a screen that stays up is showing.
+#define LATENCY_NEXT_FRAME 1            // In the next frame.
+#define LATENCY_NEXT_STEP 2             // In the first frame after the next physics step, which moves the paddles with the new switches.
+
+#ifdef LATENCY
+
+void latency_edge();
+void latency_taken(int shown);
+void latency_step();
+void latency_frame();
+void latency_second();
+
+#define LATENCY_EDGE() latency_edge()
+#define LATENCY_TAKEN(shown) latency_taken(shown)
+#define LATENCY_STEP() latency_step()
+#define LATENCY_FRAME() latency_frame()
+#define LATENCY_SECOND() latency_second()
+
+#else
+
+#define LATENCY_EDGE()
+#define LATENCY_TAKEN(shown) ((void)(shown))     // Keeps the variables that shown is made from in use.
+#define LATENCY_STEP()
+#define LATENCY_FRAME()
+#define LATENCY_SECOND()
+
+#endif
+
+#endif
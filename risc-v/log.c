@@ -0,0 +1,160 @@
+/*
+    log.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "hal.h"
+#include "irq.h"
+#include "log.h"
+
+#if LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)
+#error "LOG_BUFFER_SIZE must be a power of two"
+#endif
+
+/* boot.S has an entry that dispatches through irq.c for the causes 2 to IRQ_COUNT - 1, and the timer, the switches and the push-button use 16 to 18. */
+#if defined(LOG_UART_IRQ) && (LOG_UART_IRQ < 2 || LOG_UART_IRQ >= IRQ_COUNT || (LOG_UART_IRQ >= IRQ_TIMER && LOG_UART_IRQ <= IRQ_BUTTON))
+#error "LOG_UART_IRQ must be a free interrupt cause that boot.S has a vector for: 2-15 or 19-31"
+#endif
+
+/*
+The ring buffer has a single producer (the main loop) and a single consumer (log_drain(), from the main loop, or only from the UART interrupt when the build has LOG_UART_IRQ).
+Only the producer writes log_head and only the consumer writes log_tail, so no locking is needed.
+A message is written from log_head up to message_end first, and only published by moving log_head when it is complete,
+so the consumer never sees half a message and a message that doesn't fit can be thrown away.
+*/
+static char buffer[LOG_BUFFER_SIZE];
+static volatile unsigned int log_head = 0;
+static volatile unsigned int log_tail = 0;
+static unsigned int message_end = 0;            // Where the message being written continues. Only used by the producer.
+static int overflowed = 0;                      // 1 if the message being written didn't fit.
+static unsigned int unreported = 0;             // Dropped messages that haven't been reported in the log yet.
+static unsigned int reported = 0;               // The dropped messages that the message being written reports.
+
+unsigned int log_dropped = 0;
+
+/**
+ * Starts a new message. If messages have been dropped and there is room, a line that tells how many goes first.
+ */
+void log_begin() {
+    message_end = log_head;
+    overflowed = 0;
+    reported = 0;
+    if (unreported) {
+        log_text("log dropped ");
+        log_dec(unreported);
+        log_char('\n');
+        if (overflowed) {               // No room yet, try again with the next message.
+            message_end = log_head;
+            overflowed = 0;
+        } else {
+            reported = unreported;
+            unreported = 0;
+        }
+    }
+}
+
+/**
+ * Adds a character to the message. Never waits: if the ring buffer is full, the message is marked to be dropped.
+ */
+void log_char(char c) {
+    if (message_end - log_tail >= LOG_BUFFER_SIZE) {
+        overflowed = 1;
+        return;
+    }
+    buffer[message_end & (LOG_BUFFER_SIZE - 1)] = c;
+    message_end++;
+}
+
+void log_text(const char *text) {
+    while (*text != '\0') log_char(*text++);
+}
+
+/**
+ * Adds an unsigned decimal number to the message.
+ */
+void log_dec(unsigned int value) {
+    char digits[10];
+    int count = 0;
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while (value != 0);
+    while (count > 0) log_char(digits[--count]);
+}
+
+/**
+ * Adds a number to the message as 0x followed by eight hexadecimal digits, like print_hex32().
+ */
+void log_hex(unsigned int value) {
+    log_text("0x");
+    for (int shift = 28; shift >= 0; shift -= 4) log_char("0123456789ABCDEF"[(value >> shift) & 0xf]);
+}
+
+/**
+ * Publishes the message so that log_drain() can write it, or drops it if it didn't fit.
+ */
+void log_end() {
+    if (overflowed) {
+        log_dropped++;
+        unreported += reported + 1;             // The report at the start of the message is lost with it.
+        return;
+    }
+    log_head = message_end;
+#ifdef LOG_UART_IRQ
+    hal_uart_interrupt(1);                      // Ask the UART to interrupt when it has space for the message.
+#endif
+}
+
+/**
+ * Returns the number of characters that the next message can have without being dropped.
+ */
+int log_room() {
+    return LOG_BUFFER_SIZE - (log_head - log_tail);
+}
+
+/**
+ * Writes as much of the published messages to the UART as it has space for, without waiting.
+ * Returns the number of characters written.
+ */
+int log_drain() {
+    unsigned int tail = log_tail;
+    unsigned int head = log_head;
+    unsigned int space = hal_uart_space();
+    int count = 0;
+    while (tail != head && space > 0) {
+        hal_putc(buffer[tail & (LOG_BUFFER_SIZE - 1)]);
+        tail++;
+        space--;
+        count++;
+    }
+    log_tail = tail;                            // Free the space only after the characters have been read.
+    return count;
+}
+
+#ifdef LOG_UART_IRQ
+
+extern void enable_interrupt(unsigned int mask);
+
+/**
+ * Handles the write interrupt of the JTAG UART, which is raised while there is space in it. Stops it once everything has been written.
+ */
+static void uart_interrupt(unsigned cause) {
+    (void)cause;
+    log_drain();
+    if (log_tail == log_head) hal_uart_interrupt(0);
+}
+
+#endif
+
+/**
+ * Lets the UART interrupt drain the log when the build names its interrupt with LOG_UART_IRQ.
+ * Otherwise the log is only drained when the main loop calls log_drain().
+ */
+void log_start() {
+#ifdef LOG_UART_IRQ
+    irq_register(LOG_UART_IRQ, uart_interrupt);
+    enable_interrupt(1 << LOG_UART_IRQ);
+#endif
+}
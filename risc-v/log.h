@@ -0,0 +1,33 @@
+/*
+    log.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef LOG_H
+#define LOG_H
+
+/*
+Logging over the JTAG UART that never waits for it, see log.c.
+A message is written between log_begin() and log_end() into a ring buffer in RAM, and log_drain() moves it to the UART later as space in the UART allows.
+A message that doesn't fit in the ring buffer is dropped as a whole and counted in log_dropped.
+*/
+
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 2048            // Bytes of messages that can wait for the UART. Must be a power of two. Can be set when building.
+#endif
+
+extern unsigned int log_dropped;        // Number of messages that have been dropped since start-up.
+
+void log_begin();
+void log_char(char c);
+void log_text(const char *text);
+void log_dec(unsigned int value);
+void log_hex(unsigned int value);
+void log_end();
+int log_room();
+int log_drain();
+void log_start();
+
+#endif
@@ -5,40 +5,71 @@
     This file is in the public domain.
 */
 
-#define screen_width 320
-#define screen_height 240
-#define player_position 8
-#define player_width 5
-#define initial_ball_velocity -5
+#include "fixed.h"
+#include "geometry.h"
+#include "hal.h"
+#include "hud.h"
+#include "input.h"
+#include "pong.h"
+#include "tuning.h"
+
+#define initial_ball_velocity BALL_VELOCITY     // Field units per second, see tuning.h.
 #define initial_ball_size 5
 #define initial_paddle_height 30
-#define player_velocity 10
-#define PI 3.14159
+#define player_velocity PADDLE_VELOCITY         // Field units per second, see tuning.h.
+#define min_rebound_angle 15        // Angle in degrees that the ball leaves a paddle with when it hits the center of it.
+#define max_rebound_angle 60        // Angle in degrees that the ball leaves a paddle with when it hits the very edge of it.
+#define max_bounces 8               // The largest number of collisions that the ball can have during one tick.
+
+/* What the ball collides with first during a tick. The paddles are hit_paddle + the player number minus one. */
+#define hit_nothing -2
+#define hit_wall -1
+#define hit_paddle 0
+
+/* The top and bottom edges are walls that the ball bounces off, unless a player guards them. */
+#define top_is_wall (PLAYERS < 3)
+#define bottom_is_wall (PLAYERS < 4)
+
+#ifdef TUNABLE
+tuning_values tuning = { DEFAULT_BALL_VELOCITY, DEFAULT_PADDLE_VELOCITY, DEFAULT_FAST_BALL_ACCELERATION, DEFAULT_PRECISION_PADDLE_HEIGHT };
+#endif
 
 /* Coordinate variables */
-int player1_y = screen_height/2;
-int player2_y = screen_height/2;
-int ball_x = screen_width/2;
-int ball_y = screen_height/2;
+paddle paddles[PLAYERS] = {
+    { AXIS_VERTICAL, -1, PLAYER_POSITION, FIELD_HEIGHT, int_to_fixed(FIELD_HEIGHT/2), TO_SCREEN(FIELD_HEIGHT/2), 0, 0, initial_paddle_height },
+    { AXIS_VERTICAL, 1, FIELD_WIDTH - PLAYER_POSITION - PLAYER_WIDTH, FIELD_HEIGHT, int_to_fixed(FIELD_HEIGHT/2), TO_SCREEN(FIELD_HEIGHT/2), 0, 0, initial_paddle_height },
+#if PLAYERS > 2
+    { AXIS_HORIZONTAL, -1, HORIZONTAL_POSITION, FIELD_WIDTH, int_to_fixed(FIELD_WIDTH/2), TO_SCREEN(FIELD_WIDTH/2), 0, 0, initial_paddle_height },
+#endif
+#if PLAYERS > 3
+    { AXIS_HORIZONTAL, 1, FIELD_HEIGHT - HORIZONTAL_POSITION - PLAYER_WIDTH, FIELD_WIDTH, int_to_fixed(FIELD_WIDTH/2), TO_SCREEN(FIELD_WIDTH/2), 0, 0, initial_paddle_height },
+#endif
+};
+int ball_x[BALL_CAPACITY];          // The screen pixel that the center of each ball is drawn at.
+int ball_y[BALL_CAPACITY];
+fixed ball_fx[BALL_CAPACITY];       // Position of the center of each ball on the field, in field units, see geometry.h.
+fixed ball_fy[BALL_CAPACITY];
 
 /* Velocity variables */
-int player1_dy = 0;
-int player2_dy = 0;
-int ball_dx = 0;
-int ball_dy = 0;
+fixed ball_dx[BALL_CAPACITY];       // Field units per physics step.
+fixed ball_dy[BALL_CAPACITY];
+
+/* Ball pool variables */
+unsigned char ball_alive[BALL_CAPACITY];    // 1 if the slot holds a ball that is in play.
+int ball_slots = 0;                 // Slots from 0 up to here have been used. The slots above it have never held a ball, so loops over the balls stop here.
+int ball_count = 0;                 // Number of balls in play.
+static int next_free[BALL_CAPACITY];        // Links the slots of despawned balls into a free list.
+signed char ball_hitter[BALL_CAPACITY];     // The player number minus one of the last player that hit each ball, -1 if none has.
+static int free_slot = -1;          // The first slot in the free list, -1 if it's empty.
 
 /* Size variables */
-int paddle_height = initial_paddle_height;  // Indicates the width of each player paddle.
 int ball_size = initial_ball_size;          // Indicates the length of a side of the square ball.
 
 /* Score variables */
-int player1_score = 0;              // Displayed on the leftmost 7-segment display.
-int player2_score = 0;              // Displayed on the rightmost 7-segement display.
+int player_scores[PLAYERS];         // Players 1 and 2 are also shown on the 7-segment displays, with player 1 to the left of player 2.
 
 /* Game state variables */
-int game_state = 0;                 // Game is active if 1, game is over if 0.
-int reverse_paddles1 = 0;           // Special game mode that reverses the control of the paddles for player 1.
-int reverse_paddles2 = 0;           // Special game mode that reverses the control of the paddles for player 2.
+int game_state = GAME_TITLE;        // GAME_RUNNING, GAME_PAUSED, GAME_OVER or GAME_TITLE.
 int fast_ball = 0;                  // Special game mode that makes the ball progressively faster during the course of the game.
 int seconds = 0;
 int minutes = 0;
@@ -51,35 +82,12 @@ Special game modes:
 - PRECISION-PONG: Makes the paddles much smaller so that you must be more precise in blocking the ball.
 */
 
-/**
- * Displays a number on the seven segment displays.
- * Parameter: Display is the zero indexed value used to select which display to use. Must be 0-5, otherwise do nothing.
- * Parameter: Number is the number to use. Must be 0-9, otherwise do nothing.
- */
-void seven_segment_display(int display, int number) {
-    if(display >= 0 && display <= 5) {
-        volatile int *displayPointer = (volatile int*) 0x04000050 + 4 * display; // Creates a pointer that points to the memory adress where the 7-segment displays are. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V-board.
-
-        /* Conditional statements to set the selected display to the correct configuration. */
-        if(number == 0) *displayPointer = 0b01000000;
-        if(number == 1) *displayPointer = 0b01111001;
-        if(number == 2) *displayPointer = 0b00100100;
-        if(number == 3) *displayPointer = 0b00110000;
-        if(number == 4) *displayPointer = 0b00011001;
-        if(number == 5) *displayPointer = 0b00010010;
-        if(number == 6) *displayPointer = 0b00000010;
-        if(number == 7) *displayPointer = 0b01111000;
-        if(number == 8) *displayPointer = 0b00000000;
-        if(number == 9) *displayPointer = 0b00010000;
-    }
-}
-
 /**
  * Initializes the builtin timer on the RISV-V board and uses it to keep track of the surpassed time during the game.
  */
 void initialize_game_time() {
-    volatile int *timerPointer = (volatile int*) 0x04000020;    // Creates a pointer that points to the memory adress where the timer is. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V-board.
-    int period = 30000000 * 0.1 - 1;                           // Set timer period to 3 000 000 because the processor has a 30MHz clock frequency and we want it to tick once each 100ms. We also subtract by one because it is zero-indexed
+    volatile int *timerPointer = TIMER;                         // Creates a pointer that points to the memory adress where the timer is. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V-board.
+    int period = 30000000 / PHYSICS_HZ - 1;                     // Set timer period so that it times out once per physics step, since the processor has a 30MHz clock frequency. We also subtract by one because it is zero-indexed
 
     timerPointer += 2;                                          // Increment the pointer to periodL register
     *timerPointer = period & 0xffff;                            // Insert the low part of the period into the periodL register
@@ -96,181 +104,312 @@ void initialize_game_time() {
  * Resets the global variables and starts the game from the starting point.
  */
 void initialize_game() {
-    player1_dy = player2_dy = 0;
-    ball_dx = initial_ball_velocity;
-    ball_dy = 0;
-    
-    player1_y = player2_y = screen_height/2;
-    ball_x = screen_width/2;
-    ball_y = screen_height/2;
-
-    player1_score = player2_score = 0;
-    seven_segment_display(0, 0);        // Set the current score for player 2 to 0.
-    seven_segment_display(1, 0);        // Set the current score for player 1 to 0.
+    for (int player = 0; player < PLAYERS; player++) {
+        paddles[player].velocity = 0;
+        paddles[player].pixel = TO_SCREEN(paddles[player].track/2);
+        paddles[player].position = int_to_fixed(paddles[player].track/2);
+        player_scores[player] = 0;
+    }
+
+    for (int ball = 0; ball < ball_slots; ball++) ball_alive[ball] = 0;    // Empty the ball pool.
+    ball_slots = 0;
+    ball_count = 0;
+    free_slot = -1;
+    serve_ball();
+
+    hud_scores(0, 0);                   // Show the scores of both players as 0.
 
     seconds = 0;
     minutes = 0;
+    hud_time(0, 0);
     initialize_game_time();
-    game_state = 1;
+    game_state = GAME_RUNNING;
 }
 
 /**
  * Increments the score of the given player_number and updates the 7-segments display.
- * Parameter: player_number is either 1 or 2. Does nothing otherwise.
+ * Parameter: player_number is between 1 and PLAYERS. Does nothing otherwise.
  */
 void increment_score(int player_number) {
-    if (player_number == 1) {
-        player1_score++;                            // Increment player 1 score.
-        seven_segment_display(1, player1_score);    // Display player 1 score on the first 7-segment display.
-    }
+    if (player_number < 1 || player_number > PLAYERS) return;
 
-    if (player_number == 2) {
-        player2_score++;                            // Increment player 2 score.
-        seven_segment_display(0, player2_score);    // Display player 2 score on the second 7-segment display.
-    }
+    player_scores[player_number - 1]++;
+    hud_scores(player_scores[0], player_scores[1]); // Display the scores on the 7-segment displays.
 }
 
 /**
- * Rotate the ball vector by the given amount of degrees counter-clockwise.
- * There are preset rotation degrees. 15, 30, 45, 60, 75, 90. Automatically rounds to the closest degree.
+ * Puts a ball in play at the given position and velocity.
+ * Returns the slot of the new ball, or -1 if all BALL_CAPACITY slots are in use.
+ * The slot is taken from the free list if there is one, so the live balls never have to be moved around.
  */
-void rotate_ball_vector_counter_clockwise(int degrees) {
-    if (degrees != 15 && degrees != 30 && degrees != 45 && degrees != 60 && degrees != 75 && degrees != 90) {   // If-statement to set the amount of degrees to rotate to one of the preset amount of degrees.
-        if (degrees <= 22) degrees = 15;
-        if (degrees > 22 && degrees <= 37) degrees = 30;
-        if (degrees > 37 && degrees <= 52) degrees = 45;
-        if (degrees > 52 && degrees <= 67) degrees = 60;
-        if (degrees > 67 && degrees <= 82) degrees = 75;
-        if (degrees > 82) degrees = 90;
+int spawn_ball(fixed x, fixed y, fixed dx, fixed dy) {
+    int ball;
+    if (free_slot >= 0) {
+        ball = free_slot;
+        free_slot = next_free[ball];
+    } else if (ball_slots < BALL_CAPACITY) {
+        ball = ball_slots++;
+    } else {
+        return -1;
     }
 
-    int old_ball_dx = ball_dx;
-    int old_ball_dy = ball_dy;
-
-    if (degrees == 15) {
-        ball_dx = (float)old_ball_dx * (float)0.965 - (float)old_ball_dy * (float)0.262;    // Calculate the x-vector after rotation.
-        ball_dy = (float)old_ball_dx * (float)0.262 + (float)old_ball_dy * (float)0.965;    // Calculate the y-vector after rotation.
-    } else if (degrees == 30) {
-        ball_dx = (float)old_ball_dx * (float)0.863 - (float)old_ball_dy * (float)0.506;    // Calculate the x-vector after rotation.
-        ball_dy = (float)old_ball_dx * (float)0.506 + (float)old_ball_dy * (float)0.863;    // Calculate the y-vector after rotation.
-    } else if (degrees == 45) {
-        ball_dx = (float)old_ball_dx * (float)0.707 - (float)old_ball_dy * (float)0.707;    // Calculate the x-vector after rotation.
-        ball_dy = (float)old_ball_dx * (float)0.707 + (float)old_ball_dy * (float)0.707;    // Calculate the y-vector after rotation.
-    } else if (degrees == 60) {
-        ball_dx = (float)old_ball_dx * (float)0.498 - (float)old_ball_dy * (float)0.867;    // Calculate the x-vector after rotation.
-        ball_dy = (float)old_ball_dx * (float)0.867 + (float)old_ball_dy * (float)0.498;    // Calculate the y-vector after rotation.
-    } else if (degrees == 75) {
-        ball_dx = (float)old_ball_dx * (float)0.258 - (float)old_ball_dy * (float)0.966;    // Calculate the x-vector after rotation.
-        ball_dy = (float)old_ball_dx * (float)0.966 + (float)old_ball_dy * (float)0.258;    // Calculate the y-vector after rotation.
-    } else if (degrees == 90) {         // Standard rotation is 90 degrees.
-        ball_dx = -old_ball_dy;         // Calculate the x-vector after rotation.
-        ball_dy = old_ball_dx;          // Calculate the y-vector after rotation.
+    ball_fx[ball] = x;
+    ball_fy[ball] = y;
+    ball_dx[ball] = dx;
+    ball_dy[ball] = dy;
+    ball_x[ball] = fixed_to_int(TO_SCREEN(x));
+    ball_y[ball] = fixed_to_int(TO_SCREEN(y));
+    ball_alive[ball] = 1;
+    ball_hitter[ball] = -1;
+    ball_count++;
+    return ball;
+}
+
+/**
+ * Takes a ball out of play and puts its slot first in the free list.
+ */
+void despawn_ball(int ball) {
+    if (!ball_alive[ball]) return;
+    ball_alive[ball] = 0;
+    next_free[ball] = free_slot;
+    free_slot = ball;
+    ball_count--;
+}
+
+/**
+ * Puts SERVE_BALLS balls in the center of the screen. The first one moves straight towards player 1.
+ * The others take turns moving towards player 1 and player 2, at angles of up to 45 degrees.
+ */
+void serve_ball() {
+    for (int i = 0; i < SERVE_BALLS; i++) {
+        int angle = ((i / 2 + 3) % 7 - 3) * 15;
+        int ball = spawn_ball(int_to_fixed(FIELD_WIDTH/2), int_to_fixed(FIELD_HEIGHT/2), per_step(initial_ball_velocity), 0);
+        if (ball < 0) break;
+
+        rotate_ball_vector_counter_clockwise(ball, angle);
+        if (i % 2) ball_dx[ball] = -ball_dx[ball];
     }
+}
 
-    /* The following method instead uses a method of multyplying the balls velocity vector with the rotational matrix for a 2D vector. It unfortunately requires #include <math.h> to work, which apparently isn't supported on the RISC-V board.
-    degrees *= PI / (float)180;                                                             // Convert the amount of degrees to radians.
-    ball_dx = (float)ball_dx * (float)cos(degrees) - (float)ball_dy * (float)sin(degrees);  // Calculate the x-vector after rotation.
-    ball_dy = (float)ball_dx * (float)sin(degrees) + (float)ball_dy * (float)cos(degrees);  // Calculate the y-vector after rotation.
-    */
+/**
+ * Rotate the vector of a ball by the given amount of degrees counter-clockwise.
+ * Any whole number of degrees can be used, the sine and cosine are looked up in a table with a resolution of one degree.
+ */
+void rotate_ball_vector_counter_clockwise(int ball, int degrees) {
+    fixed cos = fixed_cos(degrees);
+    fixed sin = fixed_sin(degrees);
+    fixed old_ball_dx = ball_dx[ball];
+    fixed old_ball_dy = ball_dy[ball];
+
+    ball_dx[ball] = fixed_mul(old_ball_dx, cos) - fixed_mul(old_ball_dy, sin);  // Calculate the x-vector after rotation.
+    ball_dy[ball] = fixed_mul(old_ball_dx, sin) + fixed_mul(old_ball_dy, cos);  // Calculate the y-vector after rotation.
 }
 
 /**
- * Rotate the ball vector by the given amount of degrees clockwise.
- * There are preset rotation degrees. 15, 30, 45, 60, 75, 90. Automatically rounds to the closest degree.
+ * Rotate the vector of a ball by the given amount of degrees clockwise.
  * Makes use of the rotate_ball_vector_counter_clockwise function.
  */
-void rotate_ball_vector_clockwise(int degrees) {
-    rotate_ball_vector_counter_clockwise(degrees);  // Rotate the ball clockwise.
-    ball_dy = -ball_dy;                             // Reverse the y-vector to make the rotation clockwise instead.
+void rotate_ball_vector_clockwise(int ball, int degrees) {
+    rotate_ball_vector_counter_clockwise(ball, -degrees);
 }
 
 /**
- * Move the ball one step along its velocity vector and handle potential collisions.
+ * Sends a ball back from the paddle of a player. The further from the center of the paddle the ball hits, the steeper the angle it leaves with.
+ * The speed of the ball is kept, and it leaves away from the edge that the paddle guards.
+ * Parameter: player is the player number minus one.
  */
-void move_ball() {
-    ball_x += ball_dx;  // Move the ball along the x-axis by its corresonding motion vector.
-    ball_y += ball_dy;  // Move the ball along the y-axis by its corresonding motion vector.
-
-    /* Case when ball collides with the upper or lower wall. */
-    if(ball_y - ball_size/2 <= 0 || ball_y + ball_size/2 >= screen_height) ball_dy = -ball_dy;
-
-    /* Case when the ball collides with player 1's paddle. */
-    if(ball_x - ball_size/2 <= player_position + player_width && (ball_y - ball_size/2 <= player1_y + paddle_height/2 && ball_y + ball_size/2 >= player1_y - paddle_height/2)) {
-        ball_dx = -ball_dx;
-        if(ball_dy == 0) rotate_ball_vector_counter_clockwise(45);  // If the ball is moving in a straigth line towards the paddle, then we need to give it angle to make it more interesting.
-        ball_x = player_position + player_width + ball_size;
+void rebound_ball(int ball, int player) {
+    const paddle *p = &paddles[player];
+    int vertical = p->axis == AXIS_VERTICAL;
+    fixed speed = fixed_length(ball_dx[ball], ball_dy[ball]);
+    fixed reach = int_to_fixed(p->size/2 + ball_size/2);                        // The largest distance from the paddle center where the ball still touches the paddle.
+    fixed offset = (vertical ? ball_fy[ball] : ball_fx[ball]) - p->position;
+    fixed along = vertical ? ball_dy[ball] : ball_dx[ball];                     // The velocity of the ball along the paddle.
+
+    if (offset > reach) offset = reach;
+    if (offset < -reach) offset = -reach;
+
+    int angle = min_rebound_angle + (offset < 0 ? -offset : offset) * (max_rebound_angle - min_rebound_angle) / reach;   // Fits in 32 bits since reach is at most a few dozen units.
+    if (offset < 0 || (offset == 0 && along < 0)) angle = -angle;              // Hitting the upper (or left) half of the paddle sends the ball upwards (or to the left).
+
+    fixed away = -p->side * fixed_mul(speed, fixed_cos(angle));
+    fixed sideways = fixed_mul(speed, fixed_sin(angle));
+    if (vertical) {
+        ball_dx[ball] = away;
+        ball_dy[ball] = sideways;
+    } else {
+        ball_dx[ball] = sideways;
+        ball_dy[ball] = away;
     }
+    ball_hitter[ball] = player;
+}
 
-    /* Case when the ball collides with player 2's paddle. */
-    if(ball_x + ball_size/2 >= screen_width - player_position - player_width && (ball_y - ball_size/2 <= player2_y + paddle_height/2 && ball_y + ball_size/2 >= player2_y - paddle_height/2)) {
-        ball_dx = -ball_dx;
-        if(ball_dy == 0) rotate_ball_vector_counter_clockwise(45);  // If the ball is moving in a straigth line towards the paddle, then we need to give it angle to make it more interesting.
-        ball_x = screen_width - player_position - player_width - ball_size;
-    }
+/**
+ * Returns how long it takes, as a fraction of a tick, for the ball to travel the given distance at the given speed.
+ * Returns -1 if the ball doesn't get that far within the remaining part of the tick.
+ */
+static fixed time_to_travel(fixed distance, fixed speed, fixed remaining) {
+    if (distance > fixed_mul(speed, remaining)) return -1;
+    return fixed_fraction(distance, speed);
+}
 
-    /* Case if player 2 scores. Resets the ball. */
-    if(ball_x <= 0) {
-        increment_score(2);                 // Increment the score of player 2.
-        ball_dx = initial_ball_velocity;
-        ball_dy = 0;
-        ball_x = screen_width/2;
-        ball_y = screen_height/2;
-    /* Case if player 1 scores. Resets the ball. */
-    } else if (ball_x >= screen_width) {
-        increment_score(1);                 // Increment the score of player 1.
-        ball_dx = initial_ball_velocity;
-        ball_dy = 0;
-        ball_x = screen_width/2;
-        ball_y = screen_height/2;
-    }
+/**
+ * Returns 1 if a ball with its center at ball_center_y touches a paddle with its center at paddle_y, otherwise 0.
+ */
+static int touches_paddle(fixed ball_center_y, fixed paddle_y, fixed half_ball, fixed half_paddle) {
+    return ball_center_y - half_ball <= paddle_y + half_paddle && ball_center_y + half_ball >= paddle_y - half_paddle;
 }
 
 /**
- * Moves the paddles one step along their motion vectors if the relevant switches are active.
- * If the paddles leave the screen border, they can only move in the direction that is back towards the screen.
+ * Move a ball one step along its velocity vector and handle potential collisions.
+ * The path of the ball during the tick is tested against the walls and the paddles, so the exact time of each collision is found no matter how fast the ball is.
+ * After a collision the ball continues with its new velocity for the rest of the tick, which can lead to further collisions.
+ * Parameter: faces holds the line that the center of a ball can't pass in front of each paddle without colliding with it.
+ * Returns the player number of the player whose edge the ball left the screen through, otherwise 0.
  */
-void move_paddles() {
-    /* For player 1. */
-    if (player1_y - paddle_height/2 > 0 && player1_y + paddle_height/2 < screen_height) {   // Checks that player 1 is within the screen borders.
-        if (reverse_paddles1) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            player1_y -= player1_dy;                                                        // Moves the paddle in the unintended direction by its motion vector.
-        } else {
-            player1_y += player1_dy;                                                        // Moves the paddle in the intended direction by its motion vector.
+static int move_ball(int ball, const fixed *faces, fixed top, fixed bottom, fixed half_ball) {
+    fixed remaining = FIXED_ONE;        // The part of the tick that the ball still has to move.
+
+    for (int bounce = 0; bounce < max_bounces && remaining > 0; bounce++) {
+        fixed fx = ball_fx[ball];
+        fixed fy = ball_fy[ball];
+        fixed dx = ball_dx[ball];
+        fixed dy = ball_dy[ball];
+        int hit = hit_nothing;
+        fixed first = remaining;        // Time until the first collision.
+        fixed time = -1;
+
+        /* Case when ball collides with the upper or lower wall. */
+        if (top_is_wall && dy < 0) time = fy <= top ? 0 : time_to_travel(fy - top, -dy, remaining);
+        if (bottom_is_wall && dy > 0) time = fy >= bottom ? 0 : time_to_travel(bottom - fy, dy, remaining);
+        if (time >= 0) {
+            hit = hit_wall;
+            first = time;
         }
-    } else if (player1_y - paddle_height/2 <= 0) {                                           // Checks if the player 1 paddle is below the screen.
-        if (reverse_paddles1) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            if (player1_dy < 0) player1_y -= player1_dy;                                    // Moves the paddle in the unintended direction by its motion vector IF it's upwards.
-        } else {
-            if (player1_dy > 0) player1_y += player1_dy;                                    // Moves the paddle in the intended direction by its motion vector IF it's upwards.
-        }
-    } else if (player1_y + paddle_height/2 >= screen_height) {                               // Checks if the player 1 paddle is above the screen.
-        if (reverse_paddles1) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            if (player1_dy > 0) player1_y -= player1_dy;                                    // Moves the paddle in the unintended direction by its motion vector IF it's downwards.
-        } else {
-            if (player1_dy < 0) player1_y += player1_dy;                                    // Moves the paddle in the intended direction by its motion vector IF it's downwards.
+
+        /* Case when the ball collides with a paddle. Only possible if the ball is in front of it and moving towards it. */
+        for (int player = 0; player < PLAYERS; player++) {
+            const paddle *p = &paddles[player];
+            int vertical = p->axis == AXIS_VERTICAL;
+            fixed speed = (vertical ? dx : dy) * p->side;                   // Positive if the ball moves towards the edge that the paddle guards.
+            fixed distance = (faces[player] - (vertical ? fx : fy)) * p->side;
+
+            if (speed > 0 && distance >= 0) {
+                time = time_to_travel(distance, speed, remaining);
+                if (time >= 0 && (hit == hit_nothing || time < first) && touches_paddle(vertical ? fy + fixed_mul(dy, time) : fx + fixed_mul(dx, time), p->position, half_ball, int_to_fixed(p->size/2))) {
+                    hit = hit_paddle + player;
+                    first = time;
+                }
+            }
         }
+
+        ball_fx[ball] = fx + fixed_mul(dx, first);  // Move the ball along its motion vector until the collision, or until the end of the tick.
+        ball_fy[ball] = fy + fixed_mul(dy, first);
+        remaining -= first;
+
+        if (hit == hit_wall) ball_dy[ball] = -dy;
+        if (hit >= hit_paddle) rebound_ball(ball, hit - hit_paddle);
+        if (hit == hit_nothing) break;
     }
 
-    /* For player 2. */
-    if (player2_y - paddle_height/2 > 0 && player2_y + paddle_height/2 < screen_height) {   // Checks that player 2 is within the screen borders.
-        if (reverse_paddles2) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            player2_y -= player2_dy;                                                        // Moves the paddle in the unintended direction by its motion vector.
-        } else {
-            player2_y += player2_dy;                                                        // Moves the paddle in the intended direction by its motion vector.
-        }
-    } else if (player2_y - paddle_height/2 <= 0) {                                           // Checks if the player 2 paddle is below the screen.
-        if (reverse_paddles2) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            if (player2_dy < 0) player2_y -= player2_dy;                                    // Moves the paddle in the unintended direction by its motion vector IF it's upwards.
-        } else {
-            if (player2_dy > 0) player2_y += player2_dy;                                    // Moves the paddle in the intended direction by its motion vector IF it's upwards.
-        }
-    } else if (player2_y + paddle_height/2 >= screen_height) {                               // Checks if the player 2 paddle is above the screen.
-        if (reverse_paddles2) {                                                             // Checks if the special game mode REVERSE PADDLES is activated.
-            if (player2_dy > 0) player2_y -= player2_dy;                                    // Moves the paddle in the unintended direction by its motion vector IF it's downwards.
-        } else {
-            if (player2_dy < 0) player2_y += player2_dy;                                    // Moves the paddle in the intended direction by its motion vector IF it's downwards.
+    /* Only a ball with an extreme speed has any movement left here. Keep it between the walls. */
+    if (top_is_wall && ball_fy[ball] < top) ball_fy[ball] = top;
+    if (bottom_is_wall && ball_fy[ball] > bottom) ball_fy[ball] = bottom;
+
+    ball_x[ball] = fixed_to_int(TO_SCREEN(ball_fx[ball]));     // The pixel to draw the ball at, with the precision of the screen.
+    ball_y[ball] = fixed_to_int(TO_SCREEN(ball_fy[ball]));
+
+    if (ball_fx[ball] <= 0) return 1;                               // Passed player 1.
+    if (ball_fx[ball] >= int_to_fixed(FIELD_WIDTH)) return 2;      // Passed player 2.
+    if (!top_is_wall && ball_fy[ball] <= 0) return 3;
+    if (!bottom_is_wall && ball_fy[ball] >= int_to_fixed(FIELD_HEIGHT)) return 4;
+    return 0;
+}
+
+/**
+ * Returns the number of the player that scores when the ball passes the paddle of the given player number.
+ * That is the last player that hit the ball, or the player across from the paddle if nobody else has. With three players nobody is across from player 3,
+ * so the point goes to player 1 if the ball was moving right, away from them, and otherwise to player 2.
+ */
+static int scoring_player(int ball, int passed) {
+    int hitter = ball_hitter[ball];
+    if (hitter >= 0 && hitter != passed - 1) return hitter + 1;
+
+    int across = (passed - 1) ^ 1;      // Players 1 and 2, and 3 and 4, are across from each other.
+    if (across < PLAYERS) return across + 1;
+    return ball_dx[ball] > 0 ? 1 : 2;
+}
+
+/**
+ * Moves every ball in play one step and handles their collisions with the walls and the paddles, in one pass over the pool.
+ * The balls don't collide with each other, so the time grows linearly with the number of balls.
+ * A ball that passes a paddle gives a point to the last player that hit it, or to the player across from the paddle if nobody has, and is taken out of play.
+ * New balls are served once all of them are gone.
+ */
+void move_balls() {
+    fixed half_ball = int_to_fixed(ball_size/2);
+    fixed faces[PLAYERS];
+
+    /* The lines that the center of a ball can't pass without colliding. */
+    fixed top = half_ball;
+    fixed bottom = int_to_fixed(FIELD_HEIGHT) - half_ball;
+    for (int player = 0; player < PLAYERS; player++) {
+        const paddle *p = &paddles[player];
+        faces[player] = p->side < 0 ? int_to_fixed(p->line + PLAYER_WIDTH) + half_ball : int_to_fixed(p->line) - half_ball;
+    }
+
+    for (int ball = 0; ball < ball_slots; ball++) {
+        if (!ball_alive[ball]) continue;
+
+        int passed = move_ball(ball, faces, top, bottom, half_ball);
+        if (passed) {
+            increment_score(scoring_player(ball, passed));
+            despawn_ball(ball);
         }
     }
+
+    if (ball_count == 0) serve_ball();
+}
+
+/**
+ * Makes every ball in play faster by FAST_BALL_ACCELERATION field units per second along each axis that it moves along. Used by FAST-BALL every two seconds.
+ */
+void accelerate_balls() {
+    fixed acceleration = per_step(FAST_BALL_ACCELERATION);
+    for (int ball = 0; ball < ball_slots; ball++) {
+        if (!ball_alive[ball]) continue;
+
+        if (ball_dx[ball] > 0) ball_dx[ball] += acceleration;          // Increase the ball velocity along the x-axis.
+        else if (ball_dx[ball] < 0) ball_dx[ball] -= acceleration;
+
+        if (ball_dy[ball] > 0) ball_dy[ball] += acceleration;          // Increase the ball velocity along the y-axis.
+        else if (ball_dy[ball] < 0) ball_dy[ball] -= acceleration;
+    }
+}
+
+/**
+ * Returns the value limited to between low and high. The comparisons are turned into masks instead of branches.
+ */
+static inline fixed clamp(fixed value, fixed low, fixed high) {
+    fixed below = -(value < low);       // All ones if the value is below low, otherwise all zeros.
+    value = (value & ~below) | (low & below);
+    fixed above = -(value > high);
+    return (value & ~above) | (high & above);
+}
+
+/**
+ * Moves the paddles one step along their motion vectors, which are set by the switches or the computer player.
+ * REVERSE-PADDLES negates the motion vector, and a paddle stops at the ends of the side that it moves along.
+ */
+void move_paddles() {
+    for (int player = 0; player < PLAYERS; player++) {
+        paddle *p = &paddles[player];
+        fixed half_paddle = int_to_fixed(p->size/2);
+        fixed velocity = (p->velocity ^ -p->reversed) + p->reversed;       // Negated without a branch when reversed is 1.
+
+        p->position = clamp(p->position + velocity, half_paddle, int_to_fixed(p->track) - half_paddle);
+        p->pixel = fixed_to_int(TO_SCREEN(p->position));                    // The pixel to draw the paddle at.
+    }
 }
 
 /**
@@ -278,7 +417,7 @@ void move_paddles() {
  * For example, if the first and the second switches are turned on while all other switches are off, this function will return 0b0000000011.
  */
 int get_sw( void ) {
-  volatile int *switchPointer = (volatile int*) 0x04000010; // Creates a pointer that points to the memory adress where the toggle-switches are. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V board.
+  volatile int *switchPointer = SWITCHES;                   // Creates a pointer that points to the memory adress where the toggle-switches are. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V board.
   return *switchPointer;
 }
 
@@ -286,68 +425,67 @@ int get_sw( void ) {
  * Returns an integer which holds the status of the second button.
  */
 int get_btn( void ) {
-  volatile int *buttonPointer = (volatile int*) 0x040000d0; // Creates a pointer that points to the memory adress where the second push-button is. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V board.
+  volatile int *buttonPointer = BUTTON;                     // Creates a pointer that points to the memory adress where the second push-button is. It is volatile so that the compiler doesn't do any unneccessary optimisations that might alter the behaviour of the RISC-V board.
   return *buttonPointer;
 }
 
-/**
- * Isolates a bit in a binary number. 
- * Parameter: value, the value to extract the digit from.
- * Parameter: digitNumber, is the zero indexed position of the digit to be extracted. For example, 0 extracts the first digit of value and 1 extracts the second digit of value.
- */
-int get_digit(int value, int digitNumber) {
-  return (value >> (digitNumber)) & 1;  // Rightshift value so that the digit we want is signified by the least significant bits, and then isolate that bit by a logical bitwise AND operation with 1.
-}
+/* Paddle direction for the two switches that control a paddle, indexed by their states: neither, the lower one, the upper one, both. */
+static const signed char paddle_directions[4] = { 0, 1, -1, 0 };
+
+/* The lowest of the two switches that move each player's paddle, and the direction of paddle_directions for that player. */
+static const struct {
+    int switch_bit;
+    int sign;
+} paddle_controls[4] = {
+    { SW_PLAYER1, -1 },                 // Switch 10 moves player 1 upward and switch 9 downward, the opposite order.
+    { SW_PLAYER2, 1 },                  // Switch 1 moves player 2 upward and switch 2 downward.
+    { SW_PLAYER3, 1 },                  // Switch 4 moves player 3 to the right and switch 5 to the left.
+    { SW_PLAYER4, 1 },                  // Switch 6 moves player 4 to the right and switch 7 to the left.
+};
 
 /**
- * Sets the velocity for the paddles of both player 1 and 2 according to the value of the switches on the RISC-V board.
+ * Sets the velocity for the paddle of every player according to the value of the switches on the RISC-V board.
+ * If only the lower of a player's switches is on the paddle moves one way, if only the upper one is on it moves the other way, otherwise it stands still.
  */
 void set_paddles_velocity () {
-    int switchValues = get_sw();    // The integer value which contains the statuses of the toggle-switches on the board.
-
-    if (get_digit(switchValues, 0) == 1 && get_digit(switchValues, 1) == 0) player2_dy = player_velocity;   // If the first switch is active while the second is not, move player 2 upward.
-    if (get_digit(switchValues, 0) == 0 && get_digit(switchValues, 1) == 1) player2_dy = -player_velocity;  // If the first switch is inactive while the second is active, move player 2 downward.
-    if ((get_digit(switchValues, 0) == 0 && get_digit(switchValues, 1) == 0) || (get_digit(switchValues, 0) == 1 && get_digit(switchValues, 1) == 1)) player2_dy = 0;   // If both the first and second switches have the same state, make player 2 stationary.
-            
-    if (get_digit(switchValues, 9) == 1 && get_digit(switchValues, 8) == 0) player1_dy = player_velocity;  // If the tenth switch is active while the ninth is not, move player 1 upward.
-    if (get_digit(switchValues, 9) == 0 && get_digit(switchValues, 8) == 1) player1_dy = -player_velocity; // If the tenth switch is inactive while the ninth is active, move player 1 downward.
-    if ((get_digit(switchValues, 9) == 0 && get_digit(switchValues, 8) == 0) || (get_digit(switchValues, 9) == 1 && get_digit(switchValues, 8) == 1)) player1_dy = 0;  // If both the tenth and ninth switches have the same state, make player 1 stationary.
+    for (int player = 0; player < PLAYERS; player++) {
+        paddles[player].velocity = paddle_controls[player].sign * paddle_directions[(input_switches >> paddle_controls[player].switch_bit) & 3] * per_step(player_velocity);
+    }
 }
 
+static void set_reverse_paddles1(int on) { paddles[0].reversed = on; }
+static void set_reverse_paddles2(int on) { paddles[1].reversed = on; }
+#if PLAYERS == 2
+static void set_mega_ball(int on) { ball_size = on ? 30 : initial_ball_size; }
+static void set_precision_pong(int on) { for (int player = 0; player < PLAYERS; player++) paddles[player].size = on ? PRECISION_PADDLE_HEIGHT : initial_paddle_height; }
+static void set_fast_ball(int on) { fast_ball = on; }
+#endif
+
+/* The special game mode that each switch controls. */
+static const struct {
+    int switch_bit;
+    void (*set)(int on);
+} game_modes[] = {
+    { SW_REVERSE_PADDLES1, set_reverse_paddles1 },  // Switch 3 reverses the controls of player 1.
+    { SW_REVERSE_PADDLES2, set_reverse_paddles2 },  // Switch 8 reverses the controls of player 2.
+#if PLAYERS == 2                                    // Otherwise the switches move players 3 and 4.
+    { SW_MEGA_BALL, set_mega_ball },                // Switch 4, MEGA-BALL.
+    { SW_PRECISION_PONG, set_precision_pong },      // Switch 5, PRECISION-PONG.
+    { SW_FAST_BALL, set_fast_ball },                // Switch 6, FAST-BALL.
+#endif
+};
+
+#define game_mode_count ((int)(sizeof game_modes / sizeof game_modes[0]))
+
 /**
- * Sets the values of the variables handling the special game modes according to the value of the switches on the RISC-V board.
- * This method currently makes use of an inefficent polling method and could be improved.
+ * Turns the special game modes on or off when their switches have changed since the last tick.
+ * Modes whose switches haven't changed are left alone.
  */
 void set_special_game_modes () {
-    int switchValues = get_sw();        // The integer value which contains the statuses of the toggle-switches on the board.
+    if (input_changed == 0) return;
 
-    if (get_digit(switchValues, 2)) {   // If switch 3 is active, reverse the controls of player 1.
-        reverse_paddles1 = 1;
-    } else {
-        reverse_paddles1 = 0;
+    for (int i = 0; i < game_mode_count; i++) {
+        int bit = game_modes[i].switch_bit;
+        if ((input_changed >> bit) & 1) game_modes[i].set((input_switches >> bit) & 1);
     }
-
-    if (get_digit(switchValues, 7)) {   // If switch 8 is active, reverse the controls of player 2.
-        reverse_paddles2 = 1;
-    } else {
-        reverse_paddles2 = 0;
-    }
-
-    if (get_digit(switchValues, 3)) {   // If switch 4 is active, MEGA-BALL.
-        ball_size = 30;
-    } else {
-        ball_size = initial_ball_size;
-    }
-
-    if (get_digit(switchValues, 4)) {   // If switch 5 is active, PRECISION-PONG.
-        paddle_height = 4;
-    } else {
-        paddle_height = initial_paddle_height;
-    }
-
-    if (get_digit(switchValues, 5)) {   // If switch 6 is active, FAST-BALL.
-        fast_ball = 1;
-    } else {
-        fast_ball = 0;
-    }
-}
\ No newline at end of file
+}
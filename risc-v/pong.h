@@ -0,0 +1,112 @@
+/*
+    pong.h
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef PONG_H
+#define PONG_H
+
+#include "fixed.h"
+
+/* Number of physics steps per second. The timer times out once per step. Can be set to 60-240 when building. */
+#ifndef PHYSICS_HZ
+#define PHYSICS_HZ 120
+#endif
+
+/* The score that wins the game. Can be set to 1-99 when building. */
+#ifndef WINNING_SCORE
+#define WINNING_SCORE 5
+#endif
+
+/* The largest number of balls that can be in play at once. Can be set when building. */
+#ifndef BALL_CAPACITY
+#define BALL_CAPACITY 64
+#endif
+
+/* The number of players. Players 1 and 2 have paddles on the left and right sides, players 3 and 4 on the top and bottom. Can be set to 2-4 when building. */
+#ifndef PLAYERS
+#define PLAYERS 2
+#endif
+
+#if PLAYERS < 2 || PLAYERS > 4
+#error "PLAYERS must be between 2 and 4"
+#endif
+
+/* The number of balls that are served at the start of each rally. Can be set to 1-BALL_CAPACITY when building. */
+#ifndef SERVE_BALLS
+#define SERVE_BALLS 1
+#endif
+
+#define per_step(pixels_per_second) (int_to_fixed(pixels_per_second) / PHYSICS_HZ)  // Converts a speed to pixels per physics step.
+
+/* Values of game_state */
+#define GAME_OVER 0
+#define GAME_RUNNING 1
+#define GAME_PAUSED 2
+#define GAME_TITLE 3                    // The title screen is shown until the push-button is pressed.
+
+/* Values of paddle.axis */
+#define AXIS_VERTICAL 0                 // The paddle moves up and down along the left or right side.
+#define AXIS_HORIZONTAL 1               // The paddle moves left and right along the top or bottom.
+
+/* One player's paddle. Every paddle is moved, collided with and drawn by the same code, whatever side it is on. */
+typedef struct {
+    int axis;                           // AXIS_VERTICAL or AXIS_HORIZONTAL.
+    int side;                           // -1 if the paddle guards the left or top edge, 1 if it guards the right or bottom edge.
+    int line;                           // The first column (vertical) or row (horizontal) of the field that the paddle covers.
+    int track;                          // The length of the side that the paddle moves along, in field units, see geometry.h.
+    fixed position;                     // Position of the center of the paddle along its axis, in field units.
+    int pixel;                          // The screen pixel that the center of the paddle is drawn at.
+    fixed velocity;                     // Field units per physics step along its axis.
+    int reversed;                       // 1 while REVERSE-PADDLES makes the paddle move opposite to its velocity.
+    int size;                           // The length of the paddle along its axis, in field units.
+} paddle;
+
+/* Game logic, see pong.c */
+void initialize_game();
+void serve_ball();
+int spawn_ball(fixed x, fixed y, fixed dx, fixed dy);
+void despawn_ball(int ball);
+void rotate_ball_vector_counter_clockwise(int ball, int degrees);
+void rotate_ball_vector_clockwise(int ball, int degrees);
+void rebound_ball(int ball, int player);
+void move_balls();
+void accelerate_balls();
+void move_paddles();
+int get_sw(void);
+int get_btn(void);
+void set_paddles_velocity();
+void set_special_game_modes();
+
+/* Coordinate variables */
+extern paddle paddles[PLAYERS];         // Indexed by the player number minus one.
+extern int ball_x[BALL_CAPACITY];
+extern int ball_y[BALL_CAPACITY];
+extern fixed ball_fx[BALL_CAPACITY];
+extern fixed ball_fy[BALL_CAPACITY];
+
+/* Velocity variables */
+extern fixed ball_dx[BALL_CAPACITY];
+extern fixed ball_dy[BALL_CAPACITY];
+
+/* Ball pool variables. The balls are stored as one array per property, and slot i of every array belongs to the same ball. */
+extern unsigned char ball_alive[BALL_CAPACITY];
+extern signed char ball_hitter[BALL_CAPACITY];  // The player number minus one of the last player that hit each ball, -1 if none has.
+extern int ball_slots;
+extern int ball_count;
+
+/* Size variables */
+extern int ball_size;
+
+/* Score variables */
+extern int player_scores[PLAYERS];     // Indexed by the player number minus one.
+
+/* Game state variables */
+extern int game_state;
+extern int fast_ball;
+extern int seconds;
+extern int minutes;
+
+#endif
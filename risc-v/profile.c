@@ -0,0 +1,151 @@
+/*
+    profile.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "profile.h"
+
+#ifdef PROFILE
+
+#include "hal.h"
+#include "log.h"
+#include "pong.h"
+#include "sched.h"
+
+#define tick_budget (HAL_CYCLES_PER_SECOND / PHYSICS_HZ)   // Cycles between two timer interrupts.
+
+/* Statistics for one stage, since the last report. */
+typedef struct {
+    unsigned int calls;
+    unsigned int cycles_min;
+    unsigned int cycles_max;
+    unsigned int cycles_sum;
+    unsigned int instructions_sum;
+    unsigned int start_cycles;          // Counter values when the stage was last entered.
+    unsigned int start_instructions;
+} stage_stats;
+
+static const char *stage_names[STAGE_COUNT] = {
+    "special_game_modes",
+    "paddles_velocity",
+    "ai",
+    "move_balls",
+    "move_paddles",
+    "compose_frame",
+    "erase",
+    "draw_balls",
+    "draw_paddles",
+    "draw_texts",
+    "present_frame",
+    "tick",
+};
+
+static stage_stats stats[STAGE_COUNT];
+static unsigned int overruns = 0;       // Iterations of the game loop that took longer than the time between two timer interrupts.
+static int seconds_since_report = 0;
+
+/**
+ * Starts measuring a stage.
+ */
+void profile_begin(int stage) {
+    stats[stage].start_instructions = hal_instructions();
+    stats[stage].start_cycles = hal_cycles();
+}
+
+/**
+ * Stops measuring a stage and adds the measurement to its statistics.
+ */
+void profile_end(int stage) {
+    unsigned int cycles = hal_cycles();
+    unsigned int instructions = hal_instructions();
+    stage_stats *s = &stats[stage];
+
+    cycles -= s->start_cycles;
+    instructions -= s->start_instructions;
+
+    if (s->calls == 0 || cycles < s->cycles_min) s->cycles_min = cycles;
+    if (cycles > s->cycles_max) s->cycles_max = cycles;
+    s->cycles_sum += cycles;
+    s->instructions_sum += instructions;
+    s->calls++;
+
+    if (stage == STAGE_TICK && cycles > tick_budget) overruns++;
+}
+
+/**
+ * Logs the value right-aligned in a column of the given width.
+ */
+static void log_column(unsigned int value, int width) {
+    int digits = 1;
+    for (unsigned int rest = value / 10; rest != 0; rest /= 10) digits++;
+    for (int i = digits; i < width; i++) log_char(' ');
+    log_dec(value);
+}
+
+/**
+ * Logs the name left-aligned in a column of the given width.
+ */
+static void log_name(const char *name, int width) {
+    int length = 0;
+    while (name[length] != '\0') log_char(name[length++]);
+    for (int i = length; i < width; i++) log_char(' ');
+}
+
+/**
+ * Logs the statistics of every stage since the last report and starts over.
+ */
+static void profile_report() {
+    log_begin();
+    log_text("\nstage                 calls  cyc min  cyc avg  cyc max  ins avg\n");
+    log_end();
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        stage_stats *s = &stats[i];
+        unsigned int calls = s->calls ? s->calls : 1;
+
+        log_begin();
+        log_name(stage_names[i], 18);
+        log_column(s->calls, 9);
+        log_column(s->cycles_min, 9);
+        log_column(s->cycles_sum / calls, 9);
+        log_column(s->cycles_max, 9);
+        log_column(s->instructions_sum / calls, 9);
+        log_char('\n');
+        log_end();
+
+        s->calls = 0;
+        s->cycles_min = 0;
+        s->cycles_max = 0;
+        s->cycles_sum = 0;
+        s->instructions_sum = 0;
+    }
+    hal_disable_interrupts();           // sched_dropped is counted in the interrupt handlers.
+    unsigned int dropped = sched_dropped;
+    sched_dropped = 0;
+    hal_enable_interrupts();
+
+    log_begin();
+    log_text("overruns: ");
+    log_dec(overruns);
+    log_text("  task wait max: ");
+    log_dec(sched_latency_max);
+    log_text(" cyc  tasks dropped: ");
+    log_dec(dropped);
+    log_char('\n');
+    log_end();
+    overruns = 0;
+    sched_latency_max = 0;
+}
+
+/**
+ * Called once per second of game time. Logs a report every PROFILE_REPORT_SECONDS seconds.
+ */
+void profile_second() {
+    if (++seconds_since_report >= PROFILE_REPORT_SECONDS) {
+        seconds_since_report = 0;
+        profile_report();
+    }
+}
+
+#endif
@@ -0,0 +1,55 @@
+/*
+    profile.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/*
+Cycle and instruction counts for each stage of the game loop, from the mcycle and minstret registers.
+Only compiled in when building with PROFILE defined ('make PROFILE=1'). Otherwise every macro below expands to the plain statement or to nothing.
+*/
+
+/* Stages of the game loop */
+#define STAGE_SPECIAL_GAME_MODES 0
+#define STAGE_PADDLES_VELOCITY 1
+#define STAGE_AI 2
+#define STAGE_MOVE_BALLS 3
+#define STAGE_MOVE_PADDLES 4
+#define STAGE_COMPOSE 5
+#define STAGE_ERASE 6
+#define STAGE_DRAW_BALLS 7
+#define STAGE_DRAW_PADDLES 8
+#define STAGE_DRAW_TEXTS 9
+#define STAGE_PRESENT 10
+#define STAGE_TICK 11                   // A whole iteration of the game loop.
+#define STAGE_COUNT 12
+
+#ifndef PROFILE_REPORT_SECONDS
+#define PROFILE_REPORT_SECONDS 5        // How often the summary table is printed.
+#endif
+
+#ifdef PROFILE
+
+void profile_begin(int stage);
+void profile_end(int stage);
+void profile_second();
+
+#define PROFILE_STAGE(stage, statement) do { profile_begin(stage); statement; profile_end(stage); } while (0)
+#define PROFILE_BEGIN(stage) profile_begin(stage)
+#define PROFILE_END(stage) profile_end(stage)
+#define PROFILE_SECOND() profile_second()
+
+#else
+
+#define PROFILE_STAGE(stage, statement) statement
+#define PROFILE_BEGIN(stage)
+#define PROFILE_END(stage)
+#define PROFILE_SECOND()
+
+#endif
+
+#endif
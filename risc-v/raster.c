@@ -0,0 +1,89 @@
+/*
+    raster.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include <stdint.h>
+#include "geometry.h"
+#include "hal.h"
+#include "raster.h"
+
+volatile char *VGA = VGA_MEMORY + SCREEN_PIXELS;        // Write pixels to the screen. Starts at the framebuffer that isn't shown, see render.c.
+
+/**
+ * Writes the given color to count aligned 32-bit words, i.e. four pixels per store instruction.
+ * Parameter: destination must be aligned to 4 bytes.
+ */
+void fill_words(volatile uint32_t *destination, int count, char color) {
+    uint32_t word = (uint8_t)color * 0x01010101u;      // Repeat the color in all four bytes of the word.
+    for (int i = 0; i < count; i++) {
+        destination[i] = word;
+    }
+}
+
+/**
+ * Writes the given color to count consecutive pixels, starting at the given one. The pixels continue on the next row when a row ends.
+ * Bytes are only written for the unaligned head and tail, everything in between is filled one word at a time.
+ * The pixels must be inside the framebuffer.
+ */
+void fill_pixels(volatile char *pixel, int count, char color) {
+    while (count > 0 && ((uintptr_t)pixel & 3)) {      // Unaligned head.
+        *pixel++ = color;
+        count--;
+    }
+
+    fill_words((volatile uint32_t*) pixel, count >> 2, color);
+    pixel += count & ~3;
+    count &= 3;
+
+    while (count > 0) {                                 // Unaligned tail.
+        *pixel++ = color;
+        count--;
+    }
+}
+
+/**
+ * Writes the given color to a horizontal span of pixels on a single row.
+ * The span must already be clipped to the screen.
+ */
+static void write_span(int x, int y, int width, char color) {
+    fill_pixels(VGA + SCREEN_ROW(y) + x, width, color);
+}
+
+/**
+ * Writes the given color to a horizontal span of pixels on a single row. Pixels outside of the screen are skipped.
+ */
+void fill_span(int x, int y, int width, char color) {
+    fill_rect(x, y, width, 1, color);
+}
+
+/**
+ * Sets every pixel inside the given rectangle to the given color. Pixels outside of the screen are skipped.
+ * The rectangle is clipped to the screen once, so the rows are written without any per-pixel checks.
+ */
+void fill_rect(int x, int y, int width, int height, char color) {
+    if (x < 0) {
+        width += x;
+        x = 0;
+    }
+    if (y < 0) {
+        height += y;
+        y = 0;
+    }
+    if (x + width > SCREEN_WIDTH) width = SCREEN_WIDTH - x;
+    if (y + height > SCREEN_HEIGHT) height = SCREEN_HEIGHT - y;
+    if (width <= 0 || height <= 0) return;
+
+    for (int row = y; row < y + height; row++) {
+        write_span(x, row, width, color);
+    }
+}
+
+/**
+ * Sets every pixel on the screen to the given color.
+ */
+void fill_screen(char color) {
+    fill_words((volatile uint32_t*) VGA, SCREEN_PIXELS / 4, color);
+}
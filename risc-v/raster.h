@@ -0,0 +1,21 @@
+/*
+    raster.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stdint.h>
+
+extern volatile char *VGA;          // Write pixels to the screen
+
+void fill_words(volatile uint32_t *destination, int count, char color);
+void fill_pixels(volatile char *pixel, int count, char color);
+void fill_span(int x, int y, int width, char color);
+void fill_rect(int x, int y, int width, int height, char color);
+void fill_screen(char color);
+
+#endif
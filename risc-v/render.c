@@ -0,0 +1,394 @@
+/*
+    render.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include <stdint.h>
+#include "assets.h"
+#include "font.h"
+#include "geometry.h"
+#include "hal.h"
+#include "image.h"
+#include "pong.h"
+#include "profile.h"
+#include "raster.h"
+#include "render.h"
+#include "scanline.h"
+
+/* Text variables */
+#define text_scale (2 * SCREEN_SCALE)   // Each font pixel is drawn as 2x2 field units.
+#define text_count (PLAYERS + 1)        // The clock and a score for each player.
+#define text_clock 1
+#define game_over_color 49              // Green, the background of game_over_image.
+
+/* VGA variables */
+volatile int *VGA_CTRL = VGA_DMA;                       // VGA control registers, used to update the screen
+
+/* Double buffering variables. The screen shows one framebuffer while the next frame is drawn into the other one. */
+static volatile char * const framebuffers[2] = { VGA_MEMORY, VGA_MEMORY + SCREEN_PIXELS };
+static int back_buffer = 1;             // Index of the framebuffer that VGA currently points to. The screen shows framebuffer 0 at start-up.
+static int swap_pending = 0;            // 1 while a requested swap hasn't been completed by the VGA controller.
+
+/* A rectangle of pixels on the screen. Rectangles with a width or height of 0 are empty. */
+typedef struct {
+    int x;
+    int y;
+    int w;
+    int h;
+} rect;
+
+/* What has been drawn into one of the framebuffers. */
+typedef struct {
+    rect balls[BALL_CAPACITY];          // Where each ball was drawn, empty if its slot wasn't in use.
+    int ball_slots;                     // Number of slots in balls that were filled in.
+    rect paddles[PLAYERS];              // Where the paddle of each player was drawn.
+    int ball_size;                      // The ball size used when it was drawn.
+    int texts[text_count];              // The values of the scores and the clock when they were drawn, -1 if they must be drawn again.
+    int valid;                          // 0 if the rectangles can't be trusted and the whole framebuffer must be cleared.
+} frame;
+
+/* Where the scores and the clock are drawn on the field, how many characters wide they are, and whose score they show. */
+static const struct {
+    int x;
+    int y;
+    int length;
+    int player;                         // The player number minus one, or -1 for the clock.
+} text_fields[text_count] = {
+    { 86, 4, 2, 0 },                    // Score of player 1, left of the clock along the top of the screen.
+    { 131, 4, 5, -1 },                  // Clock, MM:SS in the center.
+    { 210, 4, 2, 1 },                   // Score of player 2, right of the clock.
+#if PLAYERS > 2
+    { 86, 222, 2, 2 },                  // Score of player 3, along the bottom of the screen.
+#endif
+#if PLAYERS > 3
+    { 210, 222, 2, 3 },                 // Score of player 4.
+#endif
+};
+
+/* Damage tracking variables */
+static frame frames[2];                 // One for each framebuffer, since each of them was last drawn two frames ago.
+
+/**
+ * Sets every pixel inside the given rectangle to the given color. Pixels outside of the screen are skipped.
+ */
+static void fill_box(rect box, char color) {
+    fill_rect(box.x, box.y, box.w, box.h, color);
+}
+
+/**
+ * Returns 1 if the rectangles share at least one pixel, otherwise 0.
+ */
+static int overlaps(rect a, rect b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+/**
+ * Returns 1 if both rectangles cover the same pixels, otherwise 0.
+ */
+static int same_box(rect a, rect b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+/**
+ * Returns the rectangle covered by a ball at its current position, or an empty rectangle if the slot isn't in play.
+ */
+static rect ball_rect(int ball) {
+    rect box = { 0, 0, 0, 0 };
+    if (ball < ball_slots && ball_alive[ball]) {
+        box.x = ball_x[ball] - TO_SCREEN(ball_size/2);
+        box.y = ball_y[ball] - TO_SCREEN(ball_size/2);
+        box.w = TO_SCREEN(ball_size);
+        box.h = TO_SCREEN(ball_size);
+    }
+    return box;
+}
+
+/**
+ * Returns the rectangle covered by the paddle of a player at its current position.
+ */
+static rect paddle_rect(int player) {
+    const paddle *p = &paddles[player];
+    rect box = { TO_SCREEN(p->line), p->pixel - TO_SCREEN(p->size/2), TO_SCREEN(PLAYER_WIDTH), TO_SCREEN(p->size) };
+    if (p->axis == AXIS_HORIZONTAL) {
+        box.x = p->pixel - TO_SCREEN(p->size/2);
+        box.y = TO_SCREEN(p->line);
+        box.w = TO_SCREEN(p->size);
+        box.h = TO_SCREEN(PLAYER_WIDTH);
+    }
+    return box;
+}
+
+/**
+ * Sets all pixels on the screen to black.
+ */
+void reset_screen(){
+    fill_screen(0x00);                      // Black
+}
+
+/**
+ * Draws every ball in play on the screen.
+ */
+void draw_balls() {
+    frame *back = &frames[back_buffer];
+
+    for (int ball = 0; ball < ball_slots; ball++) {
+        back->balls[ball] = ball_rect(ball);
+        if (ball_alive[ball]) fill_box(back->balls[ball], 0xFF);    // White pixels
+    }
+    back->ball_slots = ball_slots;
+}
+
+/**
+ * Draws the paddle of every player on the screen.
+ */
+void draw_paddles() {
+    frame *back = &frames[back_buffer];
+
+    for (int player = 0; player < PLAYERS; player++) {
+        back->paddles[player] = paddle_rect(player);
+        fill_box(back->paddles[player], 0xFF);      // White pixels
+    }
+}
+
+/**
+ * Returns the rectangle covered by one of the scores or the clock.
+ */
+static rect text_rect(int field) {
+    rect box = { TO_SCREEN(text_fields[field].x), TO_SCREEN(text_fields[field].y), (text_fields[field].length * (FONT_WIDTH + FONT_SPACING) - FONT_SPACING) * text_scale, FONT_HEIGHT * text_scale };
+    return box;
+}
+
+/**
+ * Returns the current value of one of the texts. The clock is counted in seconds.
+ */
+static int text_value(int field) {
+    if (field == text_clock) return minutes * 60 + seconds;
+    return player_scores[text_fields[field].player];
+}
+
+/**
+ * Writes a number of at most two digits into text, without a leading zero.
+ */
+static void format_score(char *text, int score) {
+    text[0] = score >= 10 ? '0' + score / 10 % 10 : ' ';
+    text[1] = '0' + score % 10;
+    text[2] = '\0';
+}
+
+/**
+ * Writes the value of one of the texts into text, which must have room for 6 characters.
+ */
+static void format_text(char *text, int field, int value) {
+    if (field == text_clock) {
+        int clock_minutes = value / 60 % 100;
+        int clock_seconds = value % 60;
+        text[0] = '0' + clock_minutes / 10;
+        text[1] = '0' + clock_minutes % 10;
+        text[2] = ':';
+        text[3] = '0' + clock_seconds / 10;
+        text[4] = '0' + clock_seconds % 10;
+        text[5] = '\0';
+    } else {
+        format_score(text, value);
+    }
+}
+
+/**
+ * Draws the scores and the clock that have changed since they were last drawn into this framebuffer.
+ * Texts that haven't changed cost nothing, so on most frames nothing is drawn at all.
+ */
+void draw_texts() {
+    frame *back = &frames[back_buffer];
+    char text[6];
+
+    for (int field = 0; field < text_count; field++) {
+        int value = text_value(field);
+        if (value == back->texts[field]) continue;
+
+        format_text(text, field, value);
+        draw_text(TO_SCREEN(text_fields[field].x), TO_SCREEN(text_fields[field].y), text, text_scale, 0xFF, 0x00);     // White on black.
+        back->texts[field] = value;
+    }
+}
+
+/**
+ * Fills the back buffer with the title screen.
+ */
+void draw_title() {
+    draw_image(0, 0, &title_image);
+}
+
+/**
+ * Draws the current positions of the ball and the paddles into the back buffer, with the pause screen on top of them.
+ */
+void draw_pause() {
+    render_frame();
+    draw_image((SCREEN_WIDTH - TO_SCREEN(pause_image.width)) / 2, (SCREEN_HEIGHT - TO_SCREEN(pause_image.height)) / 2, &pause_image);
+}
+
+/**
+ * Draws the text line centered horizontally on the game over screen, at row y of the field and with each font pixel as scale x scale field units.
+ */
+static void draw_centered(int y, const char *text, int scale) {
+    draw_text((SCREEN_WIDTH - text_width(text, TO_SCREEN(scale))) / 2, TO_SCREEN(y), text, TO_SCREEN(scale), 0xFF, game_over_color);
+}
+
+/**
+ * Fills the back buffer with the game over screen, which shows who won and the final score.
+ */
+void draw_game_over() {
+    char winner[] = "PLAYER 1 WINS!";
+    char score[PLAYERS * 5];            // Two digits and " - " for each player.
+    int length = 0;
+
+    for (int player = 1; player < PLAYERS; player++) {
+        if (player_scores[player] > player_scores[winner[7] - '1']) winner[7] = '1' + player;
+    }
+
+    draw_image(0, 0, &game_over_image);
+    draw_centered(84, winner, 3);
+
+    for (int player = 0; player < PLAYERS; player++) {
+        if (player > 0) {
+            score[length++] = ' ';
+            score[length++] = '-';
+            score[length++] = ' ';
+        }
+        format_score(score + length, player_scores[player]);
+        if (score[length] == ' ') score[length] = score[length + 1];    // No gap for a single digit.
+        else length++;
+        length++;
+    }
+    score[length] = '\0';
+    draw_centered(130, score, PLAYERS > 2 ? 2 : 4);                 // Four scores only fit in a smaller font.
+}
+
+/**
+ * Waits until the VGA controller has completed the last requested swap, so that the back buffer is no longer shown on the screen.
+ */
+static void wait_for_swap() {
+    if (swap_pending) {
+        while (*(VGA_CTRL + 3) & 1);        // The status register keeps its S bit set until the swap has happened at the next vertical sync.
+        swap_pending = 0;
+    }
+}
+
+/**
+ * Returns 1 if the VGA controller has completed the last requested swap, so that a new frame can be drawn into the back buffer without waiting, otherwise 0.
+ */
+int render_ready() {
+    if (swap_pending && (*(VGA_CTRL + 3) & 1)) return 0;
+    swap_pending = 0;
+    return 1;
+}
+
+/**
+ * Sets the pixels inside the rectangle to black, and makes the texts that it covered part of be drawn again.
+ */
+static void erase_box(frame *back, rect box) {
+    fill_box(box, 0x00);
+    for (int field = 0; field < text_count; field++) {
+        if (overlaps(box, text_rect(field))) back->texts[field] = -1;
+    }
+}
+
+/**
+ * Adds a rectangle to the objects of a composed frame, unless it is empty. Returns the new number of objects.
+ */
+static int add_box(scanline_object *objects, int count, rect box) {
+    if (box.w <= 0 || box.h <= 0) return count;
+    scanline_object object = { box.x, box.y, box.w, box.h, 0, 0 };
+    objects[count] = object;
+    return count + 1;
+}
+
+/**
+ * Draws the whole frame into the back buffer in a single pass with the scanline compositor, so every pixel is written exactly once.
+ * Used instead of clearing the screen and drawing the objects over it whenever the framebuffer can't be updated incrementally.
+ */
+void compose_frame() {
+    frame *back = &frames[back_buffer];
+    scanline_object objects[text_count + BALL_CAPACITY + PLAYERS];
+    char texts[text_count][6];
+    int count = 0;
+
+    for (int field = 0; field < text_count; field++) {
+        back->texts[field] = text_value(field);
+        format_text(texts[field], field, back->texts[field]);
+        scanline_object text = { TO_SCREEN(text_fields[field].x), TO_SCREEN(text_fields[field].y), 0, 0, texts[field], text_scale };
+        objects[count++] = text;
+    }
+    for (int ball = 0; ball < ball_slots; ball++) {
+        back->balls[ball] = ball_rect(ball);
+        count = add_box(objects, count, back->balls[ball]);
+    }
+    back->ball_slots = ball_slots;
+    for (int player = 0; player < PLAYERS; player++) {
+        back->paddles[player] = paddle_rect(player);
+        count = add_box(objects, count, back->paddles[player]);
+    }
+
+    scanline_compose(objects, count, 0xFF, 0x00);     // White on black.
+}
+
+/**
+ * Redraws the balls, the paddles, the scores and the clock at their current positions into the back buffer.
+ * Only the rectangles that were covered the last time this framebuffer was drawn are erased, instead of clearing the whole screen.
+ * The whole frame is only composed from scratch after render_invalidate() or when the ball size has changed.
+ */
+void render_frame() {
+    wait_for_swap();
+    frame *back = &frames[back_buffer];
+
+    if (!back->valid || ball_size != back->ball_size) {
+        back->valid = 1;
+        back->ball_size = ball_size;
+        PROFILE_STAGE(STAGE_COMPOSE, compose_frame());    // The old rectangles can't be trusted, so write every pixel once.
+        return;
+    }
+
+    /* Erase the objects that have moved. The objects that stayed are drawn over again below, which repairs any pixels the erased rectangles shared with them. */
+    PROFILE_BEGIN(STAGE_ERASE);
+    for (int ball = 0; ball < back->ball_slots; ball++) {
+        if (back->balls[ball].w > 0 && !same_box(back->balls[ball], ball_rect(ball))) erase_box(back, back->balls[ball]);
+    }
+    for (int player = 0; player < PLAYERS; player++) {
+        if (!same_box(back->paddles[player], paddle_rect(player))) erase_box(back, back->paddles[player]);
+    }
+    PROFILE_END(STAGE_ERASE);
+
+    PROFILE_STAGE(STAGE_DRAW_TEXTS, draw_texts());        // Draw the scores and the clock if they have changed, before the ball so that the ball stays on top.
+
+    PROFILE_STAGE(STAGE_DRAW_BALLS, draw_balls());        // Set the pixels where the balls are to white.
+    PROFILE_STAGE(STAGE_DRAW_PADDLES, draw_paddles());    // Set the pixels where the paddles are to white.
+}
+
+/**
+ * Shows the finished back buffer on the screen.
+ * The swap is only requested here, the VGA controller performs it at the next vertical sync and render_frame() waits for it before drawing again.
+ */
+void present_frame() {
+    *(VGA_CTRL + 1) = (unsigned int)(uintptr_t)(VGA);  // Make the finished frame the back buffer of the VGA controller.
+    *(VGA_CTRL + 0) = 0;                    // Request a swap of the front and back buffers.
+    swap_pending = 1;
+
+    back_buffer ^= 1;                       // Draw the next frame into the framebuffer that is currently shown.
+    VGA = framebuffers[back_buffer];
+}
+
+/**
+ * Returns the framebuffer that was presented last, which the VGA controller shows from the next vertical sync.
+ */
+volatile char *render_presented() {
+    return framebuffers[back_buffer ^ 1];
+}
+
+/**
+ * Makes the next call to render_frame() clear the whole framebuffer, for example after something else has been drawn on the screen.
+ */
+void render_invalidate() {
+    frames[0].valid = 0;
+    frames[1].valid = 0;
+}
@@ -0,0 +1,29 @@
+/*
+    render.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef RENDER_H
+#define RENDER_H
+
+/* VGA variables */
+extern volatile int *VGA_CTRL;      // VGA control registers, used to update the screen
+
+void reset_screen();
+void draw_balls();
+void draw_paddles();
+void compose_frame();
+void draw_texts();
+void draw_title();
+void draw_pause();
+void draw_game_over();
+
+int render_ready();
+void render_frame();
+void present_frame();
+volatile char *render_presented();
+void render_invalidate();
+
+#endif
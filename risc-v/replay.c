@@ -0,0 +1,170 @@
+/*
+    replay.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "replay.h"
+
+#if defined(RECORD) || defined(REPLAY)
+
+#include "log.h"
+#include "pong.h"
+
+/* One change of the input. */
+typedef struct {
+    unsigned int step;                  // Physics steps that had been run when the change was taken in.
+    int switches;
+    int button;
+} input_change;
+
+#ifdef REPLAY
+
+/* The recorded trace, generated from the file given to 'make REPLAY=...'. */
+static const input_change trace[] = {
+#include "replay-trace.inc"
+};
+
+#define trace_length ((int)(sizeof trace / sizeof trace[0]))
+
+static int trace_position = 0;
+static int replay_switches = 0;
+static int replay_button = 0;
+
+/**
+ * Returns 1 if the trace has a snapshot that was taken after the given number of physics steps, or before it, that hasn't been replayed yet.
+ */
+int replay_pending(unsigned int step) {
+    return trace_position < trace_length && trace[trace_position].step <= step;
+}
+
+/**
+ * Returns the next snapshot of the recorded trace, instead of reading the switches and the push-button.
+ * Keeps returning the last one once the trace has run out.
+ */
+void replay_input(int *switches, int *button) {
+    if (trace_position < trace_length) {
+        replay_switches = trace[trace_position].switches;
+        replay_button = trace[trace_position].button;
+        trace_position++;
+    }
+    *switches = replay_switches;
+    *button = replay_button;
+}
+
+#endif
+
+#ifdef RECORD
+
+/* Ring buffer of input changes that haven't been written to the UART yet. Filled by record_input() and emptied by replay_flush(). */
+static input_change pending[RECORD_BUFFER_SIZE];
+static unsigned int pending_head = 0;   // Incremented for each recorded change.
+static unsigned int pending_tail = 0;   // Incremented for each written change.
+static unsigned int dropped = 0;        // Changes lost because the buffer was full.
+static int last_switches = -1;
+static int last_button = -1;
+
+/**
+ * Stores a snapshot of the input in the ring buffer if it differs from the snapshot before, together with the number of physics steps that have been run.
+ * Parameter: button is the debounced state of the push-button.
+ */
+void record_input(unsigned int step, int switches, int button) {
+    if (switches == last_switches && button == last_button) return;
+    last_switches = switches;
+    last_button = button;
+
+    if (pending_head - pending_tail == RECORD_BUFFER_SIZE) {
+        dropped++;
+        return;
+    }
+    input_change *change = &pending[pending_head % RECORD_BUFFER_SIZE];
+    change->step = step;
+    change->switches = switches;
+    change->button = button;
+    pending_head++;
+}
+
+#endif
+
+/**
+ * Moves the recorded input changes to the log, which writes them to the UART without delaying a frame.
+ */
+void replay_flush() {
+#ifdef RECORD
+    for (; pending_tail != pending_head; pending_tail++) {
+        input_change *change = &pending[pending_tail % RECORD_BUFFER_SIZE];
+        log_begin();
+        log_text("rec ");
+        log_dec(change->step);
+        log_char(' ');
+        log_dec(change->switches);
+        log_char(' ');
+        log_dec(change->button);
+        log_char('\n');
+        log_end();
+    }
+    if (dropped) {
+        log_begin();
+        log_text("rec dropped ");
+        log_dec(dropped);
+        log_char('\n');
+        log_end();
+        dropped = 0;
+    }
+#endif
+}
+
+/**
+ * Mixes a value into an FNV-1a hash.
+ */
+static unsigned int hash_int(unsigned int hash, int value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (8 * i)) & 0xff;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Logs a hash of everything that decides how the game continues after the given number of physics steps, every REPLAY_HASH_STEPS steps and when the game ends.
+ * The counters of the game timer are kept in labmain.c, so the caller passes them: the physics steps since the timer last ticked and the seconds since FAST-BALL last sped up the balls.
+ */
+void replay_hash(unsigned int step, int timer_steps, int fast_ball_seconds) {
+    if (step % REPLAY_HASH_STEPS != 0 && game_state == GAME_RUNNING) return;
+
+    unsigned int hash = 2166136261u;
+    for (int ball = 0; ball < ball_slots; ball++) {
+        if (!ball_alive[ball]) continue;
+        hash = hash_int(hash, ball);
+        hash = hash_int(hash, ball_fx[ball]);
+        hash = hash_int(hash, ball_fy[ball]);
+        hash = hash_int(hash, ball_dx[ball]);
+        hash = hash_int(hash, ball_dy[ball]);
+        hash = hash_int(hash, ball_hitter[ball]);
+    }
+    for (int player = 0; player < PLAYERS; player++) {
+        hash = hash_int(hash, paddles[player].position);
+        hash = hash_int(hash, paddles[player].velocity);
+        hash = hash_int(hash, paddles[player].size);
+        hash = hash_int(hash, paddles[player].reversed);
+        hash = hash_int(hash, player_scores[player]);
+    }
+    hash = hash_int(hash, ball_size);
+    hash = hash_int(hash, game_state);
+    hash = hash_int(hash, fast_ball);
+    hash = hash_int(hash, minutes);
+    hash = hash_int(hash, seconds);
+    hash = hash_int(hash, timer_steps);
+    hash = hash_int(hash, fast_ball_seconds);
+
+    log_begin();
+    log_text("hash ");
+    log_dec(step);
+    log_char(' ');
+    log_hex(hash);
+    log_char('\n');
+    log_end();
+}
+
+#endif
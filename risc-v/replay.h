@@ -0,0 +1,46 @@
+/*
+    replay.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+/*
+Recording and replaying of matches, see replay.c.
+'make RECORD=1' logs every change of the switches and the push-button over the JTAG UART as lines of 'rec <step> <switches> <button>',
+where step is the number of physics steps that had been run when the game took the change in.
+'make REPLAY=<file>' builds the lines of such a log into the game and plays them back instead of reading the devices, each one after the same physics step,
+so the replay doesn't depend on when the timer ticks or the frames fall.
+Both modes print 'hash <step> <hash>' every REPLAY_HASH_STEPS physics steps, so that the output of two runs can be compared with diff.
+*/
+
+#ifndef RECORD_BUFFER_SIZE
+#define RECORD_BUFFER_SIZE 64           // Changes of the input that can wait to be logged.
+#endif
+
+#ifndef REPLAY_HASH_STEPS
+#define REPLAY_HASH_STEPS 4             // Physics steps between two hashes.
+#endif
+
+#if defined(RECORD) || defined(REPLAY)
+
+void record_input(unsigned int step, int switches, int button);
+int replay_pending(unsigned int step);
+void replay_input(int *switches, int *button);
+void replay_flush();
+void replay_hash(unsigned int step, int timer_steps, int fast_ball_seconds);
+
+#define REPLAY_FLUSH() replay_flush()
+#define REPLAY_HASH(step, timer_steps, fast_ball_seconds) replay_hash(step, timer_steps, fast_ball_seconds)
+
+#else
+
+#define REPLAY_FLUSH()
+#define REPLAY_HASH(step, timer_steps, fast_ball_seconds)
+
+#endif
+
+#endif
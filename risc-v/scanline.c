@@ -0,0 +1,128 @@
+/*
+    scanline.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "font.h"
+#include "geometry.h"
+#include "raster.h"
+#include "scanline.h"
+
+#define max_objects 128                 // The most objects that one frame can be composed of. Objects beyond it are left out.
+
+/* A run of foreground pixels on the current row, from start up to but not including end. */
+typedef struct {
+    int start;
+    int end;
+} span;
+
+/**
+ * Returns the number of rows that an object covers.
+ */
+static int object_height(const scanline_object *object) {
+    return object->text ? FONT_HEIGHT * object->scale : object->h;
+}
+
+/**
+ * Adds the foreground runs of a text on the given screen row to spans, and returns the new number of spans.
+ * Only the set pixels of the glyphs become runs, since the rest of the text box is background anyway.
+ */
+static int text_spans(const scanline_object *object, int row, span *spans, int count) {
+    int scale = object->scale;
+    int font_row_index = (row - object->y) / scale;
+    int x = object->x;
+
+    for (const char *character = object->text; *character != '\0'; character++, x += (FONT_WIDTH + FONT_SPACING) * scale) {
+        int bits = font_row(*character, font_row_index);
+        int column = 0;
+        while (bits != 0 && column < FONT_WIDTH) {
+            if (!((bits >> (FONT_WIDTH - 1 - column)) & 1)) {
+                column++;
+                continue;
+            }
+            int end = column + 1;
+            while (end < FONT_WIDTH && ((bits >> (FONT_WIDTH - 1 - end)) & 1)) end++;
+            if (count == SCANLINE_MAX_SPANS) return count;
+            spans[count].start = x + column * scale;
+            spans[count].end = x + end * scale;
+            count++;
+            column = end;
+        }
+    }
+    return count;
+}
+
+/**
+ * Draws every object in the given color on a background of the other color, and writes each pixel of the framebuffer exactly once.
+ * The objects are sorted by their top row first, so each row only looks at the objects that cover it.
+ * Overlapping objects are merged, so the order of the objects doesn't matter.
+ */
+void scanline_compose(const scanline_object *objects, int count, char color, char background) {
+    const scanline_object *sorted[max_objects];
+    const scanline_object *active[max_objects];
+    span spans[SCANLINE_MAX_SPANS];
+    int sorted_count = 0;
+    int active_count = 0;
+    int next = 0;                       // The first object in sorted that hasn't become active yet.
+
+    /* Sort the visible objects by their top row, with insertion sort since there are only a few dozen of them. */
+    for (int i = 0; i < count && sorted_count < max_objects; i++) {
+        const scanline_object *object = &objects[i];
+        if (object_height(object) <= 0 || (!object->text && object->w <= 0)) continue;
+
+        int j = sorted_count++;
+        while (j > 0 && sorted[j - 1]->y > object->y) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = object;
+    }
+
+    volatile char *pixel = VGA;
+    for (int row = 0; row < SCREEN_HEIGHT; row++, pixel += SCREEN_WIDTH) {
+        while (next < sorted_count && sorted[next]->y <= row) active[active_count++] = sorted[next++];
+
+        /* Collect the foreground runs of the active objects, and drop the objects that ended above this row. */
+        int span_count = 0;
+        for (int i = 0; i < active_count; i++) {
+            const scanline_object *object = active[i];
+            if (object->y + object_height(object) <= row) {
+                active[i--] = active[--active_count];
+                continue;
+            }
+            if (object->text) {
+                span_count = text_spans(object, row, spans, span_count);
+            } else if (span_count < SCANLINE_MAX_SPANS) {
+                spans[span_count].start = object->x;
+                spans[span_count].end = object->x + object->w;
+                span_count++;
+            }
+        }
+
+        /* Sort the runs from left to right. */
+        for (int i = 1; i < span_count; i++) {
+            span run = spans[i];
+            int j = i;
+            while (j > 0 && spans[j - 1].start > run.start) {
+                spans[j] = spans[j - 1];
+                j--;
+            }
+            spans[j] = run;
+        }
+
+        /* Write the row from left to right. cursor is the first pixel that hasn't been written, so overlapping runs are only written once. */
+        int cursor = 0;
+        for (int i = 0; i < span_count; i++) {
+            int start = spans[i].start > cursor ? spans[i].start : cursor;
+            int end = spans[i].end < SCREEN_WIDTH ? spans[i].end : SCREEN_WIDTH;
+            if (end <= start) continue;
+
+            fill_pixels(pixel + cursor, start - cursor, background);
+            fill_pixels(pixel + start, end - start, color);
+            cursor = end;
+        }
+        fill_pixels(pixel + cursor, SCREEN_WIDTH - cursor, background);
+    }
+}
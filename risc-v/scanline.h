@@ -0,0 +1,31 @@
+/*
+    scanline.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef SCANLINE_H
+#define SCANLINE_H
+
+/*
+Scanline compositor. Draws a whole frame of filled rectangles and texts on a background, one row at a time from the top.
+Each row is split into runs of background and foreground that are written from left to right, so every pixel of the framebuffer is written exactly once,
+in the order it is stored. A full redraw then always costs the same, however many objects overlap.
+*/
+
+#define SCANLINE_MAX_SPANS 64           // The most foreground runs on one row. Runs beyond it are left out.
+
+/* A filled rectangle, or a line of text with its top left corner at (x, y). */
+typedef struct {
+    int x;
+    int y;
+    int w;                              // Unused for a text.
+    int h;                              // Unused for a text.
+    const char *text;                   // 0 for a rectangle.
+    int scale;                          // Each font pixel of a text covers scale x scale screen pixels.
+} scanline_object;
+
+void scanline_compose(const scanline_object *objects, int count, char color, char background);
+
+#endif
@@ -0,0 +1,70 @@
+/*
+    sched.c
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#include "hal.h"
+#include "sched.h"
+
+#define queue_size 8                    // Must be a power of two.
+
+/*
+The run-queue is a ring buffer with a single producer (the interrupt handler) and a single consumer (the main loop).
+Only the producer writes queue_tail and only the consumer writes queue_head, so no locking is needed.
+*/
+static task queue[queue_size];
+static unsigned int posted_at[queue_size];     // The cycle count when each task was posted.
+static volatile unsigned int queue_head = 0;
+static volatile unsigned int queue_tail = 0;
+
+unsigned int sched_latency_max = 0;
+unsigned int sched_dropped = 0;
+
+/**
+ * Adds a task to the run-queue. Meant to be called from an interrupt handler.
+ * If the queue is full the task is dropped and counted in sched_dropped.
+ */
+void sched_post(task work) {
+    unsigned int tail = queue_tail;
+    if (tail - queue_head == queue_size) {
+        sched_dropped++;
+        return;
+    }
+    queue[tail & (queue_size - 1)] = work;
+    posted_at[tail & (queue_size - 1)] = hal_cycles();
+    queue_tail = tail + 1;              // Publish the task only after it has been written.
+}
+
+/**
+ * Runs every task in the run-queue, in the order they were posted.
+ * Returns the number of tasks that were run.
+ */
+int sched_run_pending() {
+    int count = 0;
+    while (queue_head != queue_tail) {
+        unsigned int slot = queue_head & (queue_size - 1);
+        task work = queue[slot];
+
+        unsigned int latency = hal_cycles() - posted_at[slot];
+        if (latency > sched_latency_max) sched_latency_max = latency;
+
+        queue_head++;
+        work();
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Puts the processor to sleep until the next interrupt if there is no queued work.
+ * Interrupts are disabled while the queue is checked, so that an interrupt arriving just before wfi still wakes the processor up instead of being slept through.
+ */
+void sched_idle() {
+    hal_disable_interrupts();
+    if (queue_head == queue_tail) {
+        hal_wait_for_interrupt();       // A pending interrupt wakes the processor even when interrupts are disabled.
+    }
+    hal_enable_interrupts();            // Lets the pending interrupt run.
+}
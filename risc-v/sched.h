@@ -0,0 +1,21 @@
+/*
+    sched.h
+    By Milla Gradin.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef SCHED_H
+#define SCHED_H
+
+typedef void (*task)(void);
+
+/* Scheduler statistics, reported and reset by the profiler ('make PROFILE=1') */
+extern unsigned int sched_latency_max;     // Longest time in clock cycles that a task has waited in the queue before it started running.
+extern unsigned int sched_dropped;         // Number of tasks that were posted while the queue was full.
+
+void sched_post(task work);
+int sched_run_pending();
+void sched_idle();
+
+#endif
@@ -0,0 +1,47 @@
+/*
+    tuning.h
+    By Max Berglund.
+    Last modified: 2026-10-17
+    This file is in the public domain.
+*/
+
+#ifndef TUNING_H
+#define TUNING_H
+
+/*
+Gameplay constants that decide how fast and how hard the game is.
+In the game they are constants. When TUNABLE is defined they are read from the variable tuning instead,
+so that the batch simulator in host/sweep.c can try many combinations of them in one run.
+*/
+
+#define DEFAULT_BALL_VELOCITY -50               // Field units per second that a served ball moves with.
+#define DEFAULT_PADDLE_VELOCITY 100             // Field units per second that the paddles move with.
+#define DEFAULT_FAST_BALL_ACCELERATION 10       // Field units per second that FAST-BALL adds to the ball velocity every two seconds.
+#define DEFAULT_PRECISION_PADDLE_HEIGHT 4       // The height of the paddles during PRECISION-PONG.
+
+#ifdef TUNABLE
+
+typedef struct {
+    int ball_velocity;
+    int paddle_velocity;
+    int fast_ball_acceleration;
+    int precision_paddle_height;
+} tuning_values;
+
+extern tuning_values tuning;
+
+#define BALL_VELOCITY (tuning.ball_velocity)
+#define PADDLE_VELOCITY (tuning.paddle_velocity)
+#define FAST_BALL_ACCELERATION (tuning.fast_ball_acceleration)
+#define PRECISION_PADDLE_HEIGHT (tuning.precision_paddle_height)
+
+#else
+
+#define BALL_VELOCITY DEFAULT_BALL_VELOCITY
+#define PADDLE_VELOCITY DEFAULT_PADDLE_VELOCITY
+#define FAST_BALL_ACCELERATION DEFAULT_FAST_BALL_ACCELERATION
+#define PRECISION_PADDLE_HEIGHT DEFAULT_PRECISION_PADDLE_HEIGHT
+
+#endif
+
+#endif